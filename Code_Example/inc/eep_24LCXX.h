@@ -10,6 +10,10 @@
 *
 *********************************************************************************************************************
 * @remarks
+*		The driver remembers the internal address pointer of each eeprom to read without address phase when
+*		a read continues the previous access. This assumes that the driver is the only master accessing the
+*		eeproms : the pointers are forgotten by bEEP24LCXXInitInst when the instance uses another bus, and
+*		vEEP24LCXXForgetPointer must be called when anything else accesses an eeprom of the bus.
 *
 ********************************************************************************************************************/
 
@@ -38,6 +42,10 @@
 #define EEPROM_CS_ADDR6                   (uint8_t)(6)             
 #define EEPROM_CS_ADDR7                   (uint8_t)(7)   
 #define EEPROM_ADDRESS(CS_ADDR)           (uint8_t)((EEPROM_CRTL_CODE << EEPROM_ADDR_OFFSET)|(CS_ADDR))   
+#define EEPROM_PAGE_SIZE                  (uint8_t)(32)
+#define EEPROM_DATA_SIZE_MAX              (uint16_t)(4096)
+#define EEPROM_ERASE                      (uint8_t)(0xFF)
+#define EEPROM_SCATTER_RECORD_MAX         (uint8_t)(16)
 
 /********************************************************************************************************************
  *                                                                                                                  *
@@ -65,6 +73,60 @@ enum eEEP24LCXXAddress
 
 typedef enum eEEP24LCXXAddress eEEP24LCXXAddress_t; 
 
+/*
+* Voltage class of the eeprom, given by the prefix of the part number. It sets the maximum clock of the bus.
+*/
+enum eEEP24LCXXPartClass
+{
+   EEP24LCXX_PART_24LC = 0,       /**< 2.5 V to 5.5 V, 400 kHz */
+   EEP24LCXX_PART_24AA = 1,       /**< 1.7 V to 5.5 V, 400 kHz (100 kHz below 2.5 V, use EEP24LCXX_BUS_100_KHZ) */
+   EEP24LCXX_PART_24FC = 2,       /**< 1.7 V to 5.5 V, 1 MHz */
+
+   EEP24LCXX_PART_MAX
+};
+
+typedef enum eEEP24LCXXPartClass eEEP24LCXXPartClass_t;
+
+/*
+* Clock of the I2C bus, it must be the frequency configured in the I2C object
+*/
+enum eEEP24LCXXBusClock
+{
+   EEP24LCXX_BUS_400_KHZ = 0,     /**< fast mode, default of the objects which do not set the clock */
+   EEP24LCXX_BUS_100_KHZ = 1,     /**< standard mode */
+   EEP24LCXX_BUS_1_MHZ   = 2,     /**< fast mode plus, only for 24FC parts */
+
+   EEP24LCXX_BUS_MAX
+};
+
+typedef enum eEEP24LCXXBusClock eEEP24LCXXBusClock_t;
+
+/** eeprom transfert state */
+enum EEPROM24XXTransferState
+{
+  EEPROM_STATE_DRIVER_NOT_INITIALIZED = 0,
+  EEPROM_STATE_DRIVER_INITIALIZED     = 1,
+  EEPROM_STATE_READ_IN_PROGRESS       = 2,
+  EEPROM_STATE_READ_COMPLETED         = 3,
+  EEPROM_STATE_WRITE_PAGE_COMPLETED   = 5,
+  EEPROM_STATE_WRITE_COMPLETED        = 6,
+  EEPROM_STATE_WRITE_PAGE             = 7,
+  EEPROM_STATE_TRANSFER_IN_PROGRESS   = 4,
+  EEPROM_STATE_TRANSFER_COMPLETED     = 8,
+  EEPROM_STATE_READ_ABORTED           = 9,
+  EEPROM_STATE_WRITE_ABORTED          = 10,
+  EEPROM_STATE_WAIT_WRITE_CYCLE       = 11,
+  EEPROM_STATE_CHECK_IN_PROGRESS      = 12,
+  EEPROM_STATE_CHECK_COMPLETED        = 13,
+  EEPROM_STATE_COPY_READ_IN_PROGRESS  = 14,
+  EEPROM_STATE_COPY_READ_COMPLETED    = 15,
+  EEPROM_STATE_COMPARE_COMPLETED      = 16,
+
+  EEPROM_STATE_MAX
+};
+
+typedef enum EEPROM24XXTransferState EEPROM24XXTransferState_t;
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                                              S T R U C T U R E                                                   *
@@ -89,20 +151,93 @@ typedef struct EEP24LCXXData EEP24LCXXData_t;
 
 typedef bool (*EEPCbkFunc_t)(EEP24LCXXData_t *sEEPData);   
 
+/*
+ * eeprom fill structure
+ */
+struct EEP24LCXXFill
+{
+  uint16_t   u16StartAddress;        /**< Address of the first memory case to fill */
+  uint16_t   u16DataSize;            /**< number of memory cases to fill */
+  uint8_t    u8Pattern;              /**< value written in each memory case, EEPROM_ERASE to erase */
+  bool       bSkipBlank;             /**< true : each page is read first and not written if it already contains the pattern */
+  cbkFunc_t  pfvCbkTransmitEnd;      /**< user callback function is called when a page has been written */
+  cbkFunc_t  pfvCbkError;            /**< user callback function detect the error durung the fill */
+};
+
+typedef struct EEP24LCXXFill EEP24LCXXFill_t;
+
+typedef bool (*EEPFillFunc_t)(EEP24LCXXFill_t *sEEPFill);
+
+/*
+ * eeprom record of a scattered read
+ */
+struct EEP24LCXXRecord
+{
+  uint16_t   u16Address;             /**< Address of the first memory case of the record */
+  uint8_t    *pu8Data;               /**< buffer who the record will be stored */
+  uint16_t   u16DataSize;            /**< lenght of the record */
+};
+
+typedef struct EEP24LCXXRecord EEP24LCXXRecord_t;
+
+/*
+ * eeprom scattered read structure
+ */
+struct EEP24LCXXScatter
+{
+  EEP24LCXXRecord_t  *psRecords;     /**< records to read, sorted by increasing address and without overlap */
+  uint8_t            u8RecordCount;  /**< number of records, from 1 to EEPROM_SCATTER_RECORD_MAX */
+  uint32_t           u32BusBits;     /**< result : modeled cost of the planned transactions in bit-times of the bus */
+  cbkFunc_t          pfvCbkError;    /**< user callback function detect the error durung the read */
+};
+
+typedef struct EEP24LCXXScatter EEP24LCXXScatter_t;
+
+typedef bool (*EEPScatterFunc_t)(EEP24LCXXScatter_t *psScatter);
+
+typedef EEPROM24XXTransferState_t (*EEPStateFunc_t)(void);
+
+typedef bool (*EEPOneShotFunc_t)(uint32_t u32DelayMs, cbkFunc_t pfvCbk);
+
 /*
  * eeprom object
  */
 struct EEP24LCXXObj
 {
   eEEP24LCXXAddress_t   eEEPSlaveAddress;  /**< eeprom slave address */
+  eEEP24LCXXPartClass_t eEEPPartClass;     /**< voltage class of the eeprom (24LC, 24AA or 24FC) */
+  eEEP24LCXXBusClock_t  eEEPBusClock;      /**< clock of the I2C bus, used to plan the read transactions */
   sI2CObj_t             *psI2CInst;        /**< pointer to I2C object */
   sTimerObj_t           *psTimerInst;      /**< pointer to timer object */
-  EEPCbkFunc_t          pfbEEPWriteData;   /**< This function write a collection of data in the eeprom */
-  EEPCbkFunc_t          pfbEEPReadData;    /**< This function read data in the eeprom */
+  EEPOneShotFunc_t      pfbStartOneShot;   /**< optional : start a one-shot timer which calls pfvCbk once from interrupt after u32DelayMs
+                                                milliseconds (one tick early at most), return true if it was started. It signals the end of
+                                                each write cycle, NULL_PTR : the write cycle is polled with the tick of psTimerInst */
+  EEPCbkFunc_t          pfbEEPWriteData;   /**< This function write a collection of data in the eeprom, the call which returns true reports the end once */
+  EEPCbkFunc_t          pfbEEPReadData;    /**< This function read data in the eeprom, the call which returns true reports the end once */
+  EEPFillFunc_t         pfbEEPFillData;    /**< This function fill an area of the eeprom with a pattern, without source buffer, the end is reported once */
+  EEPScatterFunc_t      pfbEEPReadScattered; /**< This function read scattered records with the cheapest transactions on the bus */
+  EEPStateFunc_t        pfeEEPGetTransferState; /**< This function return the current transfer state of the eeprom */
  };
 
 typedef struct EEP24LCXXObj EEP24LCXXObj_t;
 
+/*
+ * eeprom copy and compare structure
+ */
+struct EEP24LCXXCopy
+{
+  EEP24LCXXObj_t  *psSrcEEP;         /**< source eeprom, first eeprom of a compare */
+  EEP24LCXXObj_t  *psDstEEP;         /**< destination eeprom, second eeprom of a compare (can be the source eeprom) */
+  uint16_t        u16SrcAddress;     /**< address of the first byte in the source eeprom */
+  uint16_t        u16DstAddress;     /**< address of the first byte in the destination eeprom */
+  uint16_t        u16DataSize;       /**< number of bytes to copy or to compare */
+  bool            bEqual;            /**< compare result : true if both areas contain the same data */
+  uint16_t        u16MismatchOffset; /**< compare result : offset of the first different byte */
+  cbkFunc_t       pfvCbkError;       /**< user callback function detect the error durung the operation */
+};
+
+typedef struct EEP24LCXXCopy EEP24LCXXCopy_t;
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                                    P U B L I C  F U N C T I O N                                                  *
@@ -111,12 +246,53 @@ typedef struct EEP24LCXXObj EEP24LCXXObj_t;
 
 
 /** @brief       This function initialize eeprom 24LC32A
+  *              The driver handles one eeprom at a time : calling this function again binds it to
+  *              another instance, this must only be done when no transfer is in progress. The known
+  *              address pointers of the eeproms are forgotten when the instance uses another bus.
+  *              The initialization fails if the bus clock is faster than the voltage class of the eeprom allows.
   * @param [IN]  sEEPObj : pointer to the eeprom object
   * @return      true if instance was initialized succesfully, otherwise false
  **/
 bool bEEP24LCXXInitInst(EEP24LCXXObj_t *sEEPObj);
 
 
+/** @brief       This function tell the driver that the address pointer of an eeprom has been moved by another
+  *              master or another driver (C++ front-end), the next read of this eeprom uses an address phase
+  * @param [IN]  eSlaveAddress : slave address of the eeprom
+  * @return      none
+ **/
+void vEEP24LCXXForgetPointer(eEEP24LCXXAddress_t eSlaveAddress);
+
+
+/** @brief       This function abort the operation in progress, it must be called by the owner of the driver.
+  *              The transfer already on the bus is not stopped : no new transfer is started until the HAL
+  *              signals its end by a callback, which it must do for every transfer.
+  * @return      true if no transfer is on the bus anymore, otherwise false
+ **/
+bool bEEP24LCXXAbort(void);
+
+
+/** @brief       This function copy an area of an eeprom to another eeprom of the same bus, or to another area
+  *              of the same eeprom (the areas must not overlap, such a copy is refused). The pages go through
+  *              a 32 bytes buffer, and between two chips the next source page is read during the write cycle
+  *              of the destination.
+  *              The driver must be initialized, it must be called until it return true : the end of the
+  *              copy is reported by one call only, the next call starts a new copy.
+  * @param [IN]  psCopy : copy description
+  * @return      true if copy operation was done correctly, otherwise false
+ **/
+bool bEEP24LCXXCopyData(EEP24LCXXCopy_t *psCopy);
+
+
+/** @brief       This function compare two areas of eeproms of the same bus and stop at the first difference.
+  *              The driver must be initialized, it must be called until it return true : the end of the
+  *              compare is reported by one call only, the next call starts a new compare.
+  * @param [IN]  psCopy : compare description, bEqual and u16MismatchOffset receive the result
+  * @return      true if compare operation is finished, otherwise false
+ **/
+bool bEEP24LCXXCompareData(EEP24LCXXCopy_t *psCopy);
+
+
 #endif
 
 /********************************************************************************************************************
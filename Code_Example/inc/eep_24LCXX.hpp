@@ -0,0 +1,511 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX.hpp
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the C++17 front-end of the eeprom 24LCXX, configured at compile time.
+*
+*********************************************************************************************************************
+* @remarks
+*		The device model, the bus and the slave address are template parameters : the page size and the
+*		capacity are constexpr, so the page splitting, the range checks and the address encoding are folded
+*		by the compiler, and the bus is called statically so the calls can be inlined (I2CFuncBus).
+*		The front-end drives its page writes and page reads itself instead of calling the C driver : the C
+*		driver reaches the HAL through the function pointers of I2CObj_t and checks the geometry at run time,
+*		which is what this front-end removes. The C driver (eep_24LCXX.h) is not modified and stays available
+*		for the other operations (fill, copy, compare, scattered read, blocking and block device layers),
+*		but not on the same bus at the same time : both share one I2C HAL instance.
+*		The header does not need the C driver object, unless the bus tells the C driver that the address
+*		pointer of an eeprom has moved (I2CObjBus, or I2CFuncBus with vEEP24LCXXForgetPointer).
+*
+*		A bus type must provide the following static functions :
+*		  - bool     bStart(I2CTransfer_t *psTransfer)       : same contract as pfbMasterStartTransmit
+*		  - auto     eState(void)                            : same contract as pfeGetTransferState
+*		  - uint32_t u32TickMs(void)                         : millisecond tick used for the write cycle
+*		  - void     vPointerMoved(eEEP24LCXXAddress_t eAdd) : called before each transfer of the front-end
+*
+********************************************************************************************************************/
+
+#ifndef EXT_EEP_HPP
+#define EXT_EEP_HPP
+
+#include <cstdint>
+
+extern "C"
+{
+#include "eep_24LCXX.h"
+}
+
+
+namespace eep24lcxx
+{
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                            D E V I C E   M O D E L                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** 24LC32A : 4 KB, 32 bytes page */
+struct Model24LC32A
+{
+  static constexpr uint16_t u16PageSize     = 32U;
+  static constexpr uint32_t u32Capacity     = 4096U;
+  static constexpr uint32_t u32WriteCycleMs = 5U;
+};
+
+/** 24LC64 : 8 KB, 32 bytes page */
+struct Model24LC64
+{
+  static constexpr uint16_t u16PageSize     = 32U;
+  static constexpr uint32_t u32Capacity     = 8192U;
+  static constexpr uint32_t u32WriteCycleMs = 5U;
+};
+
+/** 24LC128 : 16 KB, 64 bytes page */
+struct Model24LC128
+{
+  static constexpr uint16_t u16PageSize     = 64U;
+  static constexpr uint32_t u32Capacity     = 16384U;
+  static constexpr uint32_t u32WriteCycleMs = 5U;
+};
+
+/** 24LC256 : 32 KB, 64 bytes page */
+struct Model24LC256
+{
+  static constexpr uint16_t u16PageSize     = 64U;
+  static constexpr uint32_t u32Capacity     = 32768U;
+  static constexpr uint32_t u32WriteCycleMs = 5U;
+};
+
+/** 24LC512 : 64 KB, 128 bytes page */
+struct Model24LC512
+{
+  static constexpr uint16_t u16PageSize     = 128U;
+  static constexpr uint32_t u32Capacity     = 65536U;
+  static constexpr uint32_t u32WriteCycleMs = 5U;
+};
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                                    B U S                                                         *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+using BusStartFunc_t    = decltype(I2CObj_t::pfbMasterStartTransmit);
+using BusStateFunc_t    = decltype(I2CObj_t::pfeGetTransferState);
+using BusTickFunc_t     = decltype(sObjTimer_t::pfu32GetTickMs);
+using BusPointerFunc_t  = void (*)(eEEP24LCXXAddress_t eSlaveAddress);
+
+/** @brief       This function is the default address pointer hook : no other driver remembers the address pointers
+  * @param [IN]  eSlaveAddress : slave address of the eeprom
+  * @return      none
+ **/
+inline void vPointerKept(eEEP24LCXXAddress_t eSlaveAddress)
+{
+  (void)eSlaveAddress;
+}
+
+/** bus adapter over existing I2C and timer objects, the calls still go through their function pointers. The objects
+    are shared with the C driver, which is told that the address pointer has moved */
+template <I2CObj_t *psI2CInst, sObjTimer_t *psTimerInst>
+struct I2CObjBus
+{
+  static bool bStart(I2CTransfer_t *psTransfer)
+  {
+    return psI2CInst->pfbMasterStartTransmit(psTransfer);
+  }
+
+  static auto eState(void)
+  {
+    return psI2CInst->pfeGetTransferState();
+  }
+
+  static uint32_t u32TickMs(void)
+  {
+    return psTimerInst->pfu32GetTickMs();
+  }
+
+  static void vPointerMoved(eEEP24LCXXAddress_t eSlaveAddress)
+  {
+    vEEP24LCXXForgetPointer(eSlaveAddress);
+  }
+};
+
+/** bus over the functions of the HAL themselves : the calls are direct, they are inlined when the compiler sees the
+    functions (same unit or link time optimization). pfvPointerMoved is vEEP24LCXXForgetPointer when the C driver
+    also uses the bus, otherwise the header needs no C object */
+template <BusStartFunc_t pfbStart, BusStateFunc_t pfeState, BusTickFunc_t pfu32Tick, BusPointerFunc_t pfvPointerMoved = vPointerKept>
+struct I2CFuncBus
+{
+  static bool bStart(I2CTransfer_t *psTransfer)
+  {
+    return pfbStart(psTransfer);
+  }
+
+  static auto eState(void)
+  {
+    return pfeState();
+  }
+
+  static uint32_t u32TickMs(void)
+  {
+    return pfu32Tick();
+  }
+
+  static void vPointerMoved(eEEP24LCXXAddress_t eSlaveAddress)
+  {
+    pfvPointerMoved(eSlaveAddress);
+  }
+};
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                                 E E P R O M                                                      *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+template <typename Model, typename Bus, eEEP24LCXXAddress_t eAddress>
+class EEP24LCXX
+{
+public:
+  static constexpr uint16_t u16PageSize = Model::u16PageSize;
+  static constexpr uint32_t u32Capacity = Model::u32Capacity;
+
+  static_assert((u16PageSize & (u16PageSize - 1U)) == 0U, "the page size must be a power of two");
+  static_assert((u32Capacity % u16PageSize) == 0U, "the capacity must be a multiple of the page size");
+  static_assert(u32Capacity <= 65536U, "only devices with a 2 bytes address are supported");
+  static_assert(u16PageSize <= 255U, "a page must fit in the 8 bits byte counters of the HAL");
+  static_assert((eAddress >= EEP24LCXX_ADDR0) && (eAddress <= EEP24LCXX_ADDR7), "invalid slave address");
+
+  /** @brief       This function check that an area is inside the eeprom
+    * @param [IN]  u32Address : start address of the area
+    * @param [IN]  u32Size    : size of the area
+    * @return      true if the area is not empty and inside the eeprom, otherwise false
+   **/
+  static constexpr bool bInRange(uint32_t u32Address, uint32_t u32Size)
+  {
+    return (u32Size > 0U) && (u32Address < u32Capacity) && (u32Size <= (u32Capacity - u32Address));
+  }
+
+  /** @brief       This function compute the number of bytes which can be written in the page of an address
+    * @param [IN]  u32Address : start address
+    * @param [IN]  u32Size    : number of bytes which remain to be written
+    * @return      number of bytes of the page write
+   **/
+  static constexpr uint16_t u16PageChunk(uint32_t u32Address, uint32_t u32Size)
+  {
+    const uint32_t u32Room = u16PageSize - (u32Address & (u16PageSize - 1U));
+
+    return static_cast<uint16_t>((u32Size < u32Room) ? u32Size : u32Room);
+  }
+
+  /** @brief       This function compute the high byte of the address sent to the eeprom
+    * @param [IN]  u32Address : memory address
+    * @return      high byte of the address
+   **/
+  static constexpr uint8_t u8AddrHigh(uint32_t u32Address)
+  {
+    return static_cast<uint8_t>((u32Address & (u32Capacity - 1U)) >> 8U);
+  }
+
+  /** @brief       This function compute the low byte of the address sent to the eeprom
+    * @param [IN]  u32Address : memory address
+    * @return      low byte of the address
+   **/
+  static constexpr uint8_t u8AddrLow(uint32_t u32Address)
+  {
+    return static_cast<uint8_t>(u32Address & 0xFFU);
+  }
+
+  /** @brief       This function write data in the eeprom, it must be called until it return true
+    * @param [IN]  u32Address : start address of the data
+    * @param [IN]  pu8Data    : data to store, it must stay valid until the end of the operation
+    * @param [IN]  u32Size    : number of bytes to write
+    * @return      true when all the pages have been written, otherwise false
+   **/
+  static bool bWrite(uint32_t u32Address, uint8_t *pu8Data, uint32_t u32Size)
+  {
+    switch (eState_m)
+    {
+      case EEPROM_STATE_DRIVER_INITIALIZED :
+      case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_READ_ABORTED       :
+      case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      {
+        if (bInRange(u32Address, u32Size) && (pu8Data != nullptr))
+        {
+          pu8Data_m      = pu8Data;
+          u32Address_m   = u32Address;
+          u32Size_m      = u32Size;
+          bEndReported_m = true;
+
+          vStartPage();
+        }
+        break;
+      }
+
+      case EEPROM_STATE_TRANSFER_COMPLETED:
+      {
+        /* the internal write cycle starts at the end of the transfer */
+        u32CycleStart_m = Bus::u32TickMs();
+        eState_m        = EEPROM_STATE_WAIT_WRITE_CYCLE;
+        break;
+      }
+
+      case EEPROM_STATE_WAIT_WRITE_CYCLE:
+      {
+        if ((Bus::u32TickMs() - u32CycleStart_m) > Model::u32WriteCycleMs)
+        {
+          u32Address_m += u16PageSize_m;
+          pu8Data_m    += u16PageSize_m;
+          u32Size_m    -= u16PageSize_m;
+
+          if (u32Size_m > 0U)
+          {
+            vStartPage();
+          }
+          else
+          {
+            eState_m = EEPROM_STATE_WRITE_COMPLETED;
+          }
+        }
+        break;
+      }
+
+      default:
+        /* wait until the transfer is completed */
+        break;
+    }
+
+    return (EEPROM_STATE_WRITE_COMPLETED == eState_m);
+  }
+
+  /** @brief       This function write data at an address known at compile time, the range is checked by the compiler
+    * @param [IN]  au8Data : data to store, it must stay valid until the end of the operation
+    * @return      true when all the pages have been written, otherwise false
+   **/
+  template <uint32_t u32Address, uint32_t u32Size>
+  static bool bWrite(uint8_t (&au8Data)[u32Size])
+  {
+    static_assert(bInRange(u32Address, u32Size), "the data does not fit in the eeprom");
+
+    return bWrite(u32Address, &au8Data[0], u32Size);
+  }
+
+  /** @brief       This function read data in the eeprom, one transfer per page. It must be called until it return
+    *              true : the end of the read is reported by one call only, the next call starts a new read
+    * @param [IN]  u32Address : start address of the data
+    * @param [OUT] pu8Data    : buffer who data will be stored
+    * @param [IN]  u32Size    : number of bytes to read
+    * @return      true when all data have been received, otherwise false
+   **/
+  static bool bRead(uint32_t u32Address, uint8_t *pu8Data, uint32_t u32Size)
+  {
+    bool bRet = false;
+
+    switch (eState_m)
+    {
+      case EEPROM_STATE_DRIVER_INITIALIZED :
+      case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_READ_ABORTED       :
+      case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      {
+        if ((eState_m == EEPROM_STATE_READ_COMPLETED) && (bEndReported_m == false))
+        {
+          /* a page of the read in progress has been received in interrupt */
+          vReadNext();
+        }
+        else if (bInRange(u32Address, u32Size) && (pu8Data != nullptr))
+        {
+          pu8Data_m      = pu8Data;
+          u32Address_m   = u32Address;
+          u32Size_m      = u32Size;
+          bEndReported_m = false;
+
+          vReadPage();
+          vReadNext();
+        }
+        break;
+      }
+
+      default:
+        /* wait until the page is received */
+        break;
+    }
+
+    /* the last page has been received */
+    if ((EEPROM_STATE_READ_COMPLETED == eState_m) && (bEndReported_m == false) && (u32Size_m == u16PageSize_m))
+    {
+      bEndReported_m = true;
+      bRet           = true;
+    }
+
+    return bRet;
+  }
+
+  /** @brief       This function read data at an address known at compile time, the range is checked by the compiler
+    * @param [OUT] au8Data : buffer who data will be stored
+    * @return      true when all data have been received, otherwise false
+   **/
+  template <uint32_t u32Address, uint32_t u32Size>
+  static bool bRead(uint8_t (&au8Data)[u32Size])
+  {
+    static_assert(bInRange(u32Address, u32Size), "the data does not fit in the eeprom");
+
+    return bRead(u32Address, &au8Data[0], u32Size);
+  }
+
+  /** @brief       This function return the current transfer state of the eeprom
+    * @return      transfer state
+   **/
+  static EEPROM24XXTransferState_t eGetTransferState(void)
+  {
+    return eState_m;
+  }
+
+private:
+  using Direction_t = decltype(I2CTransfer_t::eDirection);
+
+  /** @brief       This function start the write of the next page
+    * @return      none
+   **/
+  static void vStartPage(void)
+  {
+    u16PageSize_m = u16PageChunk(u32Address_m, u32Size_m);
+    eState_m     = EEPROM_STATE_TRANSFER_IN_PROGRESS;
+
+    if (bStartTransfer(u32Address_m, pu8Data_m, u16PageSize_m, I2C_DIR_WRITE) == false)
+    {
+      eState_m = EEPROM_STATE_WRITE_ABORTED;
+    }
+  }
+
+  /** @brief       This function start the read of the next page, the HAL counts the bytes of a transfer on 8 bits
+    * @return      none
+   **/
+  static void vReadPage(void)
+  {
+    u16PageSize_m = static_cast<uint16_t>((u32Size_m < u16PageSize) ? u32Size_m : u16PageSize);
+    eState_m      = EEPROM_STATE_READ_IN_PROGRESS;
+
+    if (bStartTransfer(u32Address_m, pu8Data_m, u16PageSize_m, I2C_DIR_WRITE_READ) == false)
+    {
+      eState_m = EEPROM_STATE_READ_ABORTED;
+    }
+  }
+
+  /** @brief       This function start the next pages of the read as long as the pages end inside their start call
+    * @return      none
+   **/
+  static void vReadNext(void)
+  {
+    while ((eState_m == EEPROM_STATE_READ_COMPLETED) && (u32Size_m > u16PageSize_m))
+    {
+      u32Address_m += u16PageSize_m;
+      pu8Data_m    += u16PageSize_m;
+      u32Size_m    -= u16PageSize_m;
+
+      vReadPage();
+    }
+  }
+
+  /** @brief       This function fill the I2C transfer and start it
+    * @param [IN]  u32Address : memory address sent in the command bytes
+    * @param [IN]  pu8Data    : data to send or to receive
+    * @param [IN]  u16Size    : number of data bytes
+    * @param [IN]  eDirection : I2C_DIR_WRITE or I2C_DIR_WRITE_READ
+    * @return      true if the transfer was started, otherwise false
+   **/
+  static bool bStartTransfer(uint32_t u32Address, uint8_t *pu8Data, uint16_t u16Size, Direction_t eDirection)
+  {
+    sI2CData_m.u8SlaveAddress    = static_cast<uint8_t>(eAddress);
+    sI2CData_m.pu8Data           = pu8Data;
+    sI2CData_m.u16DataLength     = u16Size;
+    sI2CData_m.pu8Cmd[0]         = u8AddrHigh(u32Address);
+    sI2CData_m.pu8Cmd[1]         = u8AddrLow(u32Address);
+    sI2CData_m.u8CmdLength       = 2U;
+    sI2CData_m.pfvCbkTransmitEnd = vHandler;
+    sI2CData_m.pfvCbkRcv         = vHandler;
+    sI2CData_m.pfvCbkStop        = vHandler;
+    sI2CData_m.pfvCbkError       = vErrorHandler;
+    sI2CData_m.eDirection        = eDirection;
+
+    /* the C driver must not read from the address pointer it remembers for this eeprom */
+    Bus::vPointerMoved(eAddress);
+
+    return Bus::bStart(&sI2CData_m);
+  }
+
+  /** @brief       This function is call by the I2C driver for each event of the transfer
+    * @return      none
+   **/
+  static void vHandler(void)
+  {
+    switch (Bus::eState())
+    {
+      case I2C_STATE_TRANSFER_COMPLETED:
+        if ((eState_m == EEPROM_STATE_TRANSFER_IN_PROGRESS) && (sI2CData_m.u8TxIndex == sI2CData_m.u16DataLength))
+        {
+          eState_m = EEPROM_STATE_TRANSFER_COMPLETED;
+        }
+        break;
+
+      case I2C_STATE_RECEIVE_CONDITION:
+        if ((eState_m == EEPROM_STATE_READ_IN_PROGRESS) && (sI2CData_m.u8RxIndex == sI2CData_m.u16DataLength))
+        {
+          eState_m = EEPROM_STATE_READ_COMPLETED;
+        }
+        break;
+
+      case I2C_STATE_NACK_DETECTION:
+        vErrorHandler();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /** @brief       This function is call by the I2C driver when an error occur during the transfer, whatever the error
+    * @return      none
+   **/
+  static void vErrorHandler(void)
+  {
+    /* an error without transfer in progress is ignored, it would abort an operation already completed */
+    if (eState_m == EEPROM_STATE_READ_IN_PROGRESS)
+    {
+      eState_m = EEPROM_STATE_READ_ABORTED;
+    }
+    else if (eState_m == EEPROM_STATE_TRANSFER_IN_PROGRESS)
+    {
+      eState_m = EEPROM_STATE_WRITE_ABORTED;
+    }
+    else
+    {
+      /* no transfer in progress */
+    }
+  }
+
+  static inline volatile EEPROM24XXTransferState_t eState_m        = EEPROM_STATE_DRIVER_INITIALIZED;
+  static inline I2CTransfer_t                      sI2CData_m      = {};
+  static inline uint8_t                            *pu8Data_m      = nullptr;
+  static inline uint32_t                           u32Address_m    = 0U;
+  static inline uint32_t                           u32Size_m       = 0U;
+  static inline uint32_t                           u32CycleStart_m = 0U;
+  static inline uint16_t                           u16PageSize_m   = 0U;
+  static inline bool                               bEndReported_m  = true;
+};
+
+} /* namespace eep24lcxx */
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,142 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX_bd.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the block device adapter of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+* @remarks
+*		The eeprom is seen as a set of blocks with a read / prog / erase / sync interface, the one of the
+*		flash filesystems like littlefs. An eeprom does not need to be erased, so erase does nothing and
+*		prog writes whole pages directly.
+*		Each call returns when the operation is completed. When an operating system port is selected
+*		(EEP_OS_PORT_FREERTOS or EEP_OS_PORT_POSIX), the call goes through the blocking api : the task sleeps
+*		and shares the bus mutex with the other users, bEEP24LCXXRtosInit must have been called. Otherwise
+*		the driver is polled and the core sleeps with __WFI() between two polls, it must not be used by
+*		another context during the call. An operation which times out is aborted, and the call returns
+*		when the transfer still on the bus has ended (35 ms at most).
+*		Define EEP_BD_LITTLEFS to build the littlefs configuration helper.
+*
+********************************************************************************************************************/
+
+#ifndef EXT_EEP_BD_H
+#define EXT_EEP_BD_H
+
+#include <stdbool.h>
+#include "eep_24LCXX.h"
+
+#if defined(EEP_OS_PORT_FREERTOS) || defined(EEP_OS_PORT_POSIX)
+#define EEP_BD_BLOCKING
+#include "eep_24LCXX_rtos.h"
+#endif
+
+#if defined(EEP_BD_LITTLEFS)
+#include "lfs.h"
+#endif
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_BD_OK                         (int32_t)(0)             /* same values as the littlefs error codes */
+#define EEP_BD_ERR_IO                     (int32_t)(-5)
+#define EEP_BD_ERR_INVAL                  (int32_t)(-22)
+#define EEP_BD_BLOCK_CYCLES               (int32_t)(500)           /* erase cycles before a block is moved by the filesystem */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * eeprom block device structure
+ */
+struct EEP24LCXXBd
+{
+  EEP24LCXXObj_t  *psEEPObj;         /**< eeprom of the block device */
+  uint16_t        u16BaseAddress;    /**< address of the first block, multiple of EEPROM_PAGE_SIZE */
+  uint16_t        u16BlockSize;      /**< size of a block, multiple of u16CacheSize */
+  uint16_t        u16BlockCount;     /**< number of blocks */
+  uint16_t        u16CacheSize;      /**< size of the caches of the filesystem, multiple of EEPROM_PAGE_SIZE */
+  uint32_t        u32TimeOutMs;      /**< maximum duration of one prog or of one page of a read */
+};
+
+typedef struct EEP24LCXXBd EEP24LCXXBd_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+/** @brief       This function check the geometry of a block device and initialize its eeprom
+  * @param [IN]  psBd : block device
+  * @return      true if the block device can be used, otherwise false
+ **/
+bool bEEP24LCXXBdInit(EEP24LCXXBd_t *psBd);
+
+
+/** @brief       This function read data in a block
+  * @param [IN]  psBd      : block device
+  * @param [IN]  u32Block  : block to read
+  * @param [IN]  u32Offset : offset of the first byte in the block
+  * @param [OUT] pvBuffer  : buffer who data will be stored
+  * @param [IN]  u32Size   : number of bytes to read
+  * @return      EEP_BD_OK, EEP_BD_ERR_INVAL if the area is outside the block, EEP_BD_ERR_IO if the read failed
+ **/
+int32_t i32EEP24LCXXBdRead(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, void *pvBuffer, uint32_t u32Size);
+
+
+/** @brief       This function write whole pages in a block
+  * @param [IN]  psBd      : block device
+  * @param [IN]  u32Block  : block to write
+  * @param [IN]  u32Offset : offset of the first byte in the block, multiple of EEPROM_PAGE_SIZE
+  * @param [IN]  pvBuffer  : data to write
+  * @param [IN]  u32Size   : number of bytes to write, multiple of EEPROM_PAGE_SIZE
+  * @return      EEP_BD_OK, EEP_BD_ERR_INVAL if the area is not made of pages of the block, EEP_BD_ERR_IO if the write failed
+ **/
+int32_t i32EEP24LCXXBdProg(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, const void *pvBuffer, uint32_t u32Size);
+
+
+/** @brief       This function erase a block, nothing is done since an eeprom page is written without erase
+  * @param [IN]  psBd     : block device
+  * @param [IN]  u32Block : block to erase
+  * @return      EEP_BD_OK, EEP_BD_ERR_INVAL if the block does not exist
+ **/
+int32_t i32EEP24LCXXBdErase(EEP24LCXXBd_t *psBd, uint32_t u32Block);
+
+
+/** @brief       This function wait the end of the writes, a prog already returns at the end of its last write cycle
+  * @param [IN]  psBd : block device
+  * @return      EEP_BD_OK, EEP_BD_ERR_INVAL if the block device is not valid
+ **/
+int32_t i32EEP24LCXXBdSync(EEP24LCXXBd_t *psBd);
+
+
+#if defined(EEP_BD_LITTLEFS)
+
+/** @brief       This function fill the block device part of a littlefs configuration : context, callbacks and
+  *              sizes. The other fields (buffers, name_max, ...) are left to the caller.
+  *              littlefs needs blocks of at least 128 bytes.
+  * @param [IN]  psBd  : initialized block device
+  * @param [OUT] psCfg : littlefs configuration
+  * @return      none
+ **/
+void vEEP24LCXXBdLfsConfig(EEP24LCXXBd_t *psBd, struct lfs_config *psCfg);
+
+#endif
+
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
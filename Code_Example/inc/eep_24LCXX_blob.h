@@ -0,0 +1,90 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX_blob.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the compressed blob api of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+* @remarks
+*		A blob is compressed with a LZSS coder (window of 256 bytes, matches of 2 to 17 bytes) while it is
+*		written, one page at a time, and decompressed while it is read. The window is the user buffer
+*		itself, the control block of the api takes 88 bytes on a 32-bit target (page buffer 32, transfer
+*		description 24, header 5, bit stream state and addresses), the blob structure of the user 24.
+*		In the eeprom a blob is a header (magic byte, size and CRC-16 of the data) followed by the bit
+*		stream, the CRC is checked after the decompression so a blob whose write was cut is not read.
+*		One blob operation can run at a time, the eeprom driver must not be used meanwhile.
+*
+********************************************************************************************************************/
+
+#ifndef EXT_EEP_BLOB_H
+#define EXT_EEP_BLOB_H
+
+#include <stdbool.h>
+#include "eep_24LCXX.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_BLOB_HEADER_SIZE              (uint16_t)(5)
+#define EEP_BLOB_PACKED_SIZE_MAX(size)    (uint16_t)(EEP_BLOB_HEADER_SIZE + ((((uint32_t)(size) * 9) + 7) / 8))   /* data which does not compress */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * eeprom blob structure
+ */
+struct EEP24LCXXBlob
+{
+  EEP24LCXXObj_t  *psEEPObj;         /**< eeprom of the blob */
+  uint16_t        u16Address;        /**< address of the blob in the eeprom */
+  uint16_t        u16Capacity;       /**< number of bytes reserved for the blob in the eeprom, header included */
+  uint8_t         *pu8Data;          /**< in write operation : data to compress, unchanged until the end of the write */
+                                     /**< in read operation  : buffer who decompressed data will be stored */
+  uint16_t        u16DataSize;       /**< in write operation : size of the data */
+                                     /**< in read operation  : size of the buffer, receives the size of the data */
+  uint16_t        u16PackedSize;     /**< result : number of bytes of the blob in the eeprom, header included */
+  bool            bAborted;          /**< result : true if the operation failed (bus error, capacity or buffer too small, invalid blob) */
+  cbkFunc_t       pfvCbkError;       /**< user callback function detect the error durung the operation */
+};
+
+typedef struct EEP24LCXXBlob EEP24LCXXBlob_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+/** @brief       This function compress data and write it in the eeprom, one page per transfer.
+  *              It must be called until it return true, a new write starts at the next call.
+  * @param [IN]  psBlob : blob description, u16PackedSize and bAborted receive the result
+  * @return      true if write operation is finished, otherwise false
+ **/
+bool bEEP24LCXXBlobWrite(EEP24LCXXBlob_t *psBlob);
+
+
+/** @brief       This function read a blob in the eeprom and decompress it in the user buffer.
+  *              It must be called until it return true, a new read starts at the next call.
+  * @param [IN]  psBlob : blob description, u16DataSize, u16PackedSize and bAborted receive the result
+  * @return      true if read operation is finished, otherwise false
+ **/
+bool bEEP24LCXXBlobRead(EEP24LCXXBlob_t *psBlob);
+
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
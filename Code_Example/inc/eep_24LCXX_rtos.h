@@ -0,0 +1,66 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX_rtos.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the blocking and thread safe api of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+* @remarks
+*		The calling task sleeps on a semaphore while the I2C transfer is running and during the internal
+*		write cycle of the chip. All the eeprom instances share one bus mutex, so several tasks can use
+*		several eeproms connected to the same I2C object.
+*		The eeprom instances must not be used with pfbEEPWriteData / pfbEEPReadData at the same time.
+*		An operation which fails or times out is aborted before the bus is given back. The HAL must end
+*		every transfer it started with a callback, even after an error.
+*
+********************************************************************************************************************/
+
+#ifndef EXT_EEP_RTOS_H
+#define EXT_EEP_RTOS_H
+
+#include <stdbool.h>
+#include "eep_24LCXX.h"
+#include "eep_os_port.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+/** @brief       This function create the bus mutex and the completion semaphore, it must be called once
+  *              before the scheduler is started
+  * @return      true if the operating system objects were created, otherwise false
+ **/
+bool bEEP24LCXXRtosInit(void);
+
+
+/** @brief       This function write data in the eeprom and return when all pages have been written
+  * @param [IN]  psEEPObj     : pointer to an initialized eeprom object
+  * @param [IN]  psEEPData    : eeprom data, the user callbacks are still called
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation or EEP_OS_WAIT_FOREVER
+  * @return      true if write operation was done correctly, otherwise false
+ **/
+bool bEEP24LCXXWriteBlocking(EEP24LCXXObj_t *psEEPObj, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs);
+
+
+/** @brief       This function read data in the eeprom and return when all data have been received
+  * @param [IN]  psEEPObj     : pointer to an initialized eeprom object
+  * @param [IN]  psEEPData    : eeprom data, the user callbacks are still called
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation or EEP_OS_WAIT_FOREVER
+  * @return      true if read operation was done correctly, otherwise false
+ **/
+bool bEEP24LCXXReadBlocking(EEP24LCXXObj_t *psEEPObj, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs);
+
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,113 @@
+/********************************************************************************************************************
+* @file		eep_os_port.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the operating system abstraction used by the blocking eeprom api.
+*
+*********************************************************************************************************************
+* @remarks
+*		Exactly one port must be selected at build time :
+*		  - EEP_OS_PORT_FREERTOS : FreeRTOS semaphores (target, Cortex-M ports, see eep_os_freertos.c)
+*		  - EEP_OS_PORT_POSIX    : pthreads (host test)
+*
+********************************************************************************************************************/
+
+#ifndef EEP_OS_PORT_H
+#define EEP_OS_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_OS_NO_WAIT                    (uint32_t)(0)
+#define EEP_OS_WAIT_FOREVER               (uint32_t)(0xFFFFFFFF)
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** handle of a mutex, the content depends of the selected port */
+typedef void *EEPOsMutex_t;
+
+/** handle of a binary semaphore, the content depends of the selected port */
+typedef void *EEPOsSem_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function create a mutex
+  * @param [OUT] psMutex : created mutex
+  * @return      true if the mutex was created, otherwise false
+ **/
+bool bEEPOsMutexCreate(EEPOsMutex_t *psMutex);
+
+
+/** @brief       This function take a mutex
+  * @param [IN]  sMutex       : mutex to take
+  * @param [IN]  u32TimeOutMs : maximum waiting time in milliseconds or EEP_OS_WAIT_FOREVER
+  * @return      true if the mutex was taken, otherwise false
+ **/
+bool bEEPOsMutexTake(EEPOsMutex_t sMutex, uint32_t u32TimeOutMs);
+
+
+/** @brief       This function release a mutex
+  * @param [IN]  sMutex : mutex to release
+  * @return      none
+ **/
+void vEEPOsMutexGive(EEPOsMutex_t sMutex);
+
+
+/** @brief       This function create a binary semaphore, the semaphore is created empty
+  * @param [OUT] psSem : created semaphore
+  * @return      true if the semaphore was created, otherwise false
+ **/
+bool bEEPOsSemCreate(EEPOsSem_t *psSem);
+
+
+/** @brief       This function wait until the semaphore is given
+  * @param [IN]  sSem         : semaphore to take
+  * @param [IN]  u32TimeOutMs : maximum waiting time in milliseconds, EEP_OS_NO_WAIT or EEP_OS_WAIT_FOREVER
+  * @return      true if the semaphore was taken, otherwise false
+ **/
+bool bEEPOsSemTake(EEPOsSem_t sSem, uint32_t u32TimeOutMs);
+
+
+/** @brief       This function give a semaphore, it can be called from an interrupt
+  * @param [IN]  sSem : semaphore to give
+  * @return      none
+ **/
+void vEEPOsSemGiveFromIsr(EEPOsSem_t sSem);
+
+
+/** @brief       This function put the calling task to sleep
+  * @param [IN]  u32DelayMs : sleeping time in milliseconds
+  * @return      none
+ **/
+void vEEPOsDelayMs(uint32_t u32DelayMs);
+
+
+/** @brief       This function return the time since the start of the scheduler
+  * @return      time in milliseconds
+ **/
+uint32_t u32EEPOsGetTickMs(void);
+
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
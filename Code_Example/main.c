@@ -11,6 +11,10 @@
 *
 *********************************************************************************************************************
 *@remarks
+*		The end of the write cycle of each page is signalled by a one-shot timer (pfbStartOneShot), the
+*		core sleeps with WFI between the pages instead of polling the tick. The timer HAL only gives the
+*		tick, so the one-shot is served at each wake-up of the core by the tick interrupt : its callback
+*		runs from the main loop, never during a call of the driver.
 *
 ********************************************************************************************************************/
 
@@ -39,6 +43,50 @@
 uint32_t u32CurrentTime = 0;
 uint8_t  u8Index = 0;
 
+sObjTimer_t *psOneShotTimer = NULL_PTR;
+cbkFunc_t   pfvOneShotCbk   = NULL_PTR;
+uint32_t    u32OneShotStart = 0;
+uint32_t    u32OneShotDelay = 0;
+
+
+/** @brief       This function start the one-shot timer, it has the prototype of EEPOneShotFunc_t
+  * @param [IN]  u32DelayMs : delay in milliseconds, counted in ticks
+  * @param [IN]  pfvCbk     : function called once at the end of the delay
+  * @return      true if the timer was started, otherwise false
+ **/
+bool bStartOneShot(uint32_t u32DelayMs, cbkFunc_t pfvCbk)
+{
+  bool bRet = false;
+
+  /* only one write cycle is timed at a time */
+  if ((psOneShotTimer != NULL_PTR) && (pfvOneShotCbk == NULL_PTR))
+  {
+    u32OneShotStart = psOneShotTimer->pfu32GetTickMs();
+    u32OneShotDelay = u32DelayMs;
+    pfvOneShotCbk   = pfvCbk;
+    bRet            = true;
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function call the callback of the one-shot timer when its delay is over, it is called
+  *              at each wake-up of the core
+  * @return      none
+ **/
+void vServeOneShot(void)
+{
+  cbkFunc_t pfvCbk = pfvOneShotCbk;
+
+  if ((pfvCbk != NULL_PTR) && ((psOneShotTimer->pfu32GetTickMs() - u32OneShotStart) >= u32OneShotDelay))
+  {
+    /* the timer is free again before the callback, which may start the next write cycle */
+    pfvOneShotCbk = NULL_PTR;
+    pfvCbk();
+  }
+}
+
 void vToggLedGreen(void)
 {
   LED_GREEN_TOGGLE;
@@ -75,6 +123,9 @@ int main()
   /* Start timer */
   sTimerInst.pfvStart();
 
+  /* the one-shot timer counts the ticks of this timer */
+  psOneShotTimer = &sTimerInst;
+
   /* initialization of receive data structure */
   EEP24LCXXData_t sRData =
   {
@@ -114,8 +165,11 @@ int main()
   EEP24LCXXObj_t sEEPInst =
   {
     .eEEPSlaveAddress = EEP24LCXX_ADDR0,
+    .eEEPPartClass    = EEP24LCXX_PART_24LC,
+    .eEEPBusClock     = EEP24LCXX_BUS_400_KHZ,
     .psI2CInst        = &sI2CInst,
-    .psTimerInst      = &sTimerInst 
+    .psTimerInst      = &sTimerInst,
+    .pfbStartOneShot  = bStartOneShot
   };
 
   /* Initialization of EEPROM */
@@ -132,28 +186,37 @@ int main()
 
   while(1)
   {
-    /* write Data */
-    if(sEEPInst.pfbEEPWriteData(&sWData))
-    {   
-      /* if write transaction was done correctly, read the data */ 
-      sEEPInst.pfbEEPReadData(&sRData);
-
-      /* go to the next address */
-      sRData.u16StartAddress += DATA_LENGHT;
-      sWData.u16StartAddress = sRData.u16StartAddress;
-      u8Index += DATA_LENGHT; 
-      
-      /* check that the index and the address do not exceed the limit  of the eeprom*/
-      if(sRData.u16StartAddress > EEPROM_ADDR_MAX)
-      {
-        sRData.u16StartAddress = EEPROM_ZERO;
-      }
+    /* write Data, the pages are started by the one-shot timer and the core sleeps between them */
+    while(sEEPInst.pfbEEPWriteData(&sWData) == false)
+    {
+      __WFI();
+      vServeOneShot();
+    }
 
+    /* read the data, the core sleeps until they are received */
+    while(sEEPInst.pfbEEPReadData(&sRData) == false)
+    {
+      __WFI();
     }
 
-    /* wait 50 milliseconds between each reading and blink the led */
+    /* go to the next address */
+    sRData.u16StartAddress += DATA_LENGHT;
+    sWData.u16StartAddress = sRData.u16StartAddress;
+    u8Index += DATA_LENGHT; 
+      
+    /* check that the next data do not exceed the limit of the eeprom, the write waits for its end */
+    if((sRData.u16StartAddress + DATA_LENGHT - 1) > EEPROM_ADDR_MAX)
+    {
+      sRData.u16StartAddress = EEPROM_ZERO;
+      sWData.u16StartAddress = EEPROM_ZERO;
+    }
+
+    /* wait 50 milliseconds between each reading and blink the led, the core sleeps until the next interrupt */
     u32CurrentTime = (uint32_t)~(sTimerInst.pfu32GetTickMs()) + 1;
-    while((sTimerInst.pfu32GetTickMs() + u32CurrentTime) <= TIME_OUT);
+    while((sTimerInst.pfu32GetTickMs() + u32CurrentTime) <= TIME_OUT)
+    {
+      __WFI();
+    }
 
     /* write 32 byte on specified address  */
     sWData.pu8Data     = &u8TxBuffer[u8Index % ((TX_BUFFER_SIZE/DATA_LENGHT)*DATA_LENGHT)];
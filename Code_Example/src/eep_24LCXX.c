@@ -13,6 +13,7 @@
 ********************************************************************************************************************/
 
 
+#include <string.h>
 #include "eep_24LCXX.h"
 #include "pin_function.h"
 
@@ -25,15 +26,22 @@
 #define EEPROM_TIME_OUT                      5
 #define EEPROM_DATA_LENGHT                   (uint8_t)(1)
 #define EEPROM_CMD_LENGHT                    (uint8_t)(2)
-#define EEPROM_PAGE_SIZE                     (uint8_t)(32)
-#define EEPROM_ERASE                         (uint8_t)(0xFF)
+#define EEPROM_COMPARE_CHUNK                 (uint8_t)(EEPROM_PAGE_SIZE / 2)
 #define EEPROM_ADDR_MAX                      (uint16_t)(0x0FFF)
-#define EEPROM_DATA_SIZE_MAX                 (uint16_t)(4096)
 #define EEPROM_HIGH_ADDR_OFFSET              (uint16_t)(0x08)
 #define EEPROM_LOW_ADDR_MSK                  (uint16_t)(0x00FF)
 #define EEPROM_HIGH_ADDR_MSK                 (uint16_t)(0x000F)
 #define EEPROM_LOW_ADDR(addr)                (uint8_t)((addr) & EEPROM_LOW_ADDR_MSK)
 #define EEPROM_HIGH_ADDR(addr)               (uint8_t)(((addr) >> EEPROM_HIGH_ADDR_OFFSET) & (EEPROM_HIGH_ADDR_MSK))
+#define EEPROM_PAGE_MSK                      (uint16_t)(EEPROM_PAGE_SIZE - 1)
+#define EEPROM_CS_COUNT                      (uint8_t)(8)
+#define EEPROM_CS_MSK                        (uint8_t)(0x07)
+#define EEPROM_BITS_PER_BYTE                 (uint32_t)(9)
+#define EEPROM_BITS_RANDOM_READ              (uint32_t)(3 + (4 * EEPROM_BITS_PER_BYTE))
+#define EEPROM_BITS_CURRENT_READ             (uint32_t)(2 + EEPROM_BITS_PER_BYTE)
+#define EEPROM_TRANSFER_START_NS             (uint32_t)(10000)
+#define EEPROM_NS_PER_SECOND                 (uint32_t)(1000000000)
+#define EEPROM_KHZ                           (uint32_t)(1000)
 #define LED_GREEN_PIN                        (uint8_t)14
 #define LED_RED_PIN                          (uint8_t)13
 #define LED_BLUE_PIN                         (uint8_t)15
@@ -45,27 +53,6 @@
  *                                                                                                                  *
  *******************************************************************************************************************/
 
-/** eeprom transfert state */
-enum EEPROM24XXTransferState
-{
-  EEPROM_STATE_DRIVER_NOT_INITIALIZED = 0,
-  EEPROM_STATE_DRIVER_INITIALIZED     = 1,
-  EEPROM_STATE_READ_IN_PROGRESS       = 2,
-  EEPROM_STATE_READ_COMPLETED         = 3,
-  EEPROM_STATE_WRITE_PAGE_COMPLETED   = 5,
-  EEPROM_STATE_WRITE_COMPLETED        = 6,
-  EEPROM_STATE_WRITE_PAGE             = 7,
-  EEPROM_STATE_TRANSFER_IN_PROGRESS   = 4,
-  EEPROM_STATE_TRANSFER_COMPLETED     = 8,
-  EEPROM_STATE_READ_ABORTED           = 9,
-  EEPROM_STATE_WRITE_ABORTED          = 10,
-  EEPROM_STATE_WAIT_WRITE_CYCLE       = 11,
-
-  EEPROM_STATE_MAX
-};
-
-typedef enum EEPROM24XXTransferState EEPROM24XXTransferState_t;
-
 /** eeprom driver state */
 enum EEPROM24XXDRVState
 {
@@ -77,24 +64,84 @@ enum EEPROM24XXDRVState
 
 typedef enum EEPROM24XXDRVState EEPROM24XXDRVState_t;
 
+/** eeprom operation which uses the page state machine */
+enum EEPROM24XXOperation
+{
+  EEPROM_OP_WRITE   = 0,
+  EEPROM_OP_FILL    = 1,
+  EEPROM_OP_COPY    = 2,
+  EEPROM_OP_COMPARE = 3,
+  EEPROM_OP_SCATTER = 4,
+  EEPROM_OP_READ    = 5,
+
+  EEPROM_OP_MAX
+};
+
+typedef enum EEPROM24XXOperation EEPROM24XXOperation_t;
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                                              S T R U C T U R E                                                   *
  *                                                                                                                  *
  *******************************************************************************************************************/
 
+/** I2C bus clock profile */
+struct EEPROMBusProfile
+{
+  uint32_t                  u32ClockKHz;               ///< clock of the bus
+  uint32_t                  u32BusFreeNs;              ///< minimum time between a stop and the next start (tBUF)
+};
+
+typedef struct EEPROMBusProfile EEPROMBusProfile_t;
+
 /** EEPROM control block structure */
 struct EEPROMDrv
 {
   EEPROM24XXDRVState_t      eDrvState;                 ///< Allow to now if EEPROM was initialized
-  EEPROM24XXTransferState_t eTranferState;             ///< Alllow to now if write or read operation is in progress
+  volatile EEPROM24XXTransferState_t eTranferState;    ///< Alllow to now if write or read operation is in progress
   eEEP24LCXXAddress_t       eAdresse;                  ///< EEPROM adress 
   sObjTimer_t               *psTimerInst;              ///< Pointer to an timer object
+  EEPOneShotFunc_t          pfbStartOneShot;           ///< one-shot timer of the eeprom object, NULL_PTR when the write cycle is polled
   I2CObj_t                  *psI2CInst;                ///< Pointer to an I2C object
   I2CTransfer_t             sI2CData;                  ///< data to use by I2C driver 
   cbkFunc_t                 pfvCbkTransmitEnd;         ///< user callback function is called when all data have been written */ 
   cbkFunc_t                 pfvCbkRcv;                 ///< user callback function detect the reception of each byte */
   cbkFunc_t                 pfvCbkError;               ///< user callback function detect the error durung write or read operation */ 
+  uint8_t                   *pu8WriteData;             ///< data of the write operation in progress
+  uint16_t                  u16WriteSize;              ///< number of bytes which remain to be written
+  uint16_t                  u16WriteAddress;           ///< start address of the page in progress
+  uint16_t                  u16PageEndAddr;            ///< end address of the page in progress
+  uint16_t                  u16WriteIndex;             ///< index in pu8WriteData of the page in progress
+  uint8_t                   u8PageSize;                ///< number of bytes of the page in progress
+  uint32_t                  u32WriteTimeOut;           ///< start time of the write cycle (two's complement)
+  volatile bool             bWriteCycleTimer;          ///< true when the end of the write cycle is signaled by the timer, the interrupt then starts the next page
+  EEPROM24XXOperation_t     eOperation;                ///< operation in progress in the page state machine
+  uint8_t                   u8WriteSlave;              ///< slave address of the eeprom written by the operation
+  uint8_t                   u8ReadSlave;               ///< slave address of the source eeprom of a copy or a compare
+  uint16_t                  u16SrcAddress;             ///< start address in the source eeprom of a copy or a compare
+  uint16_t                  u16CmpAddress;             ///< start address in the second eeprom of a compare
+  volatile bool             bCopyBuffered;             ///< copy : the page buffer contains the source of the current page
+  volatile bool             bCopyPrefetch;             ///< copy : the source of the next page is being read
+  bool                      bCompareSecond;            ///< compare : the chunk of the second eeprom is being read
+  bool                      bEndReported;              ///< the end of the operation has been returned by its poll function
+  volatile bool             bTransferPending;          ///< a transfer started by the driver has not been ended by a callback yet
+  volatile bool             bTransferAborted;          ///< the pending transfer belongs to an aborted operation, its error ends it
+  bool                      bPageLoop;                 ///< the loop of vEEP24LC32PageDone is running
+  bool                      bPageAgain;                ///< a page has been done again during the loop of vEEP24LC32PageDone
+  EEP24LCXXCopy_t           *psCopy;                   ///< compare : user structure which receives the result
+  bool                      bSkipBlank;                ///< true when the pages of the fill are checked before being written
+  uint8_t                   u8FillPattern;             ///< value written by the fill
+  uint8_t                   au8PageBuffer[EEPROM_PAGE_SIZE]; ///< pattern of the fill, also receives the blank check
+  uint32_t                  u32TransferBits;           ///< fixed cost of one transfer in bit-times (tBUF and start of the transfer)
+  EEP24LCXXScatter_t        *psScatter;                ///< scattered read : user structure in progress
+  uint8_t                   u8RunCount;                ///< scattered read : number of planned transactions
+  uint8_t                   u8RunIndex;                ///< scattered read : transaction in progress
+  uint16_t                  u16RunAddress;             ///< scattered read : first address read by the transaction in progress
+  bool                      bRunBuffered;              ///< scattered read : the transaction in progress is read in the page buffer
+  uint8_t                   au8RunFirst[EEPROM_SCATTER_RECORD_MAX]; ///< scattered read : first record of each transaction
+  bool                      abRunCurrent[EEPROM_SCATTER_RECORD_MAX]; ///< scattered read : the transaction continues from the address pointer
+  uint16_t                  au16AddrPointer[EEPROM_CS_COUNT]; ///< internal address pointer of each eeprom of the bus, by chip select
+  bool                      abPointerValid[EEPROM_CS_COUNT];  ///< the address pointer of the eeprom is known
 };
 
 typedef struct EEPROMDrv EEPROMDrv_t;
@@ -109,6 +156,42 @@ typedef struct EEPROMDrv EEPROMDrv_t;
                                                     .eTranferState              = EEPROM_STATE_DRIVER_NOT_INITIALIZED, \
                                                     .eAdresse                   = EEP24LCXX_ADDR_MAX,                  \
                                                     .psTimerInst                = NULL_PTR,                            \
+                                                    .pfbStartOneShot            = NULL_PTR,                            \
+                                                    .pu8WriteData               = NULL_PTR,                            \
+                                                    .u16WriteSize               = EEPROM_ZERO,                         \
+                                                    .u16WriteAddress            = EEPROM_ZERO,                         \
+                                                    .u16PageEndAddr             = EEPROM_ZERO,                         \
+                                                    .u16WriteIndex              = EEPROM_ZERO,                         \
+                                                    .u8PageSize                 = EEPROM_ZERO,                         \
+                                                    .u32WriteTimeOut            = EEPROM_ZERO,                         \
+                                                    .bWriteCycleTimer           = false,                               \
+                                                    .eOperation                 = EEPROM_OP_WRITE,                     \
+                                                    .u8WriteSlave               = EEP24LCXX_ADDR_MAX,                  \
+                                                    .u8ReadSlave                = EEP24LCXX_ADDR_MAX,                  \
+                                                    .u16SrcAddress              = EEPROM_ZERO,                         \
+                                                    .u16CmpAddress              = EEPROM_ZERO,                         \
+                                                    .bCopyBuffered              = false,                               \
+                                                    .bCopyPrefetch              = false,                               \
+                                                    .bCompareSecond             = false,                               \
+                                                    .bEndReported               = true,                                 \
+                                                    .bTransferPending           = false,                               \
+                                                    .bTransferAborted           = false,                               \
+                                                    .bPageLoop                  = false,                               \
+                                                    .bPageAgain                 = false,                               \
+                                                    .psCopy                     = NULL_PTR,                            \
+                                                    .bSkipBlank                 = false,                               \
+                                                    .u8FillPattern              = EEPROM_ERASE,                        \
+                                                    .au8PageBuffer              = {EEPROM_ZERO},                       \
+                                                    .u32TransferBits            = EEPROM_ZERO,                         \
+                                                    .psScatter                  = NULL_PTR,                            \
+                                                    .u8RunCount                 = EEPROM_ZERO,                         \
+                                                    .u8RunIndex                 = EEPROM_ZERO,                         \
+                                                    .u16RunAddress              = EEPROM_ZERO,                         \
+                                                    .bRunBuffered               = false,                               \
+                                                    .au8RunFirst                = {EEPROM_ZERO},                       \
+                                                    .abRunCurrent               = {false},                             \
+                                                    .au16AddrPointer            = {EEPROM_ZERO},                       \
+                                                    .abPointerValid             = {false},                             \
                                                     .sI2CData.u8SlaveAddress    = EEP24LCXX_ADDR_MAX,                  \
                                                     .sI2CData.pu8Data           = NULL_PTR,                            \
                                                     .sI2CData.u16DataLength     = EEPROM_ZERO,                         \
@@ -126,43 +209,247 @@ typedef struct EEPROMDrv EEPROMDrv_t;
 /** EEPROM control block variable */
 static EEPROMDrv_t sCb = EEPROM_CB_DRV_INIT;
 
+/** bus clock profiles, indexed by eEEP24LCXXBusClock_t */
+static const EEPROMBusProfile_t asBusProfile[EEP24LCXX_BUS_MAX] =
+{
+  [EEP24LCXX_BUS_400_KHZ] = { .u32ClockKHz = 400,  .u32BusFreeNs = 1300 },
+  [EEP24LCXX_BUS_100_KHZ] = { .u32ClockKHz = 100,  .u32BusFreeNs = 4700 },
+  [EEP24LCXX_BUS_1_MHZ]   = { .u32ClockKHz = 1000, .u32BusFreeNs = 500  }
+};
+
+/** maximum bus clock of each voltage class, indexed by eEEP24LCXXPartClass_t */
+static const uint32_t au32PartClockKHz[EEP24LCXX_PART_MAX] =
+{
+  [EEP24LCXX_PART_24LC] = 400,
+  [EEP24LCXX_PART_24AA] = 400,
+  [EEP24LCXX_PART_24FC] = 1000
+};
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
  *                                                                                                                  *
  *******************************************************************************************************************/
 
+/** @brief       This function start the transfer prepared in the control block and keep the address pointer that
+  *              the eeprom will have at its end. The pointer is set first because the transfer can end in the call.
+  * @param [IN]  u16Pointer : address pointer of the eeprom at the end of the transfer
+  * @return      true if the transfer was started, otherwise false
+ **/
+static bool bEEP24LC32StartTransfer(uint16_t u16Pointer);
+
+
+/** @brief       This function check if the address pointer of an eeprom is known and equal to an address
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [IN]  u16Address     : address of the next byte to read
+  * @return      true if a current address read can be used, otherwise false
+ **/
+static bool bEEP24LC32AtPointer(uint8_t u8SlaveAddress, uint16_t u16Address);
+
+
+/** @brief       This function check if an operation has ended without being reported by its poll function yet
+  * @param [IN]  eOperation : operation of the poll function
+  * @param [IN]  eEndState  : state at the end of the operation
+  * @return      true if the operation must not be started again, otherwise false
+ **/
+static bool bEEP24LC32EndPending(EEPROM24XXOperation_t eOperation, EEPROM24XXTransferState_t eEndState);
+
+
+/** @brief       This function report the end of an operation once : the operation may end in interrupt, the
+  *              first call of its poll function after the end returns true and the next one starts it again
+  * @param [IN]  eOperation : operation of the poll function
+  * @param [IN]  eEndState  : state at the end of the operation
+  * @return      true if the end of the operation is reported by this call, otherwise false
+ **/
+static bool bEEP24LC32ReportEnd(EEPROM24XXOperation_t eOperation, EEPROM24XXTransferState_t eEndState);
+
+
 /** @brief       This function write a collection of data in a page ofthe eeprom
+  * @param [IN]  u8SlaveAddress  : slave address of the eeprom
   * @param [IN]  u16PageAddress  : adress of data to write
   * @param [IN]  pu8Data          : data to store
   * @return      true if write operation was don correctly, otherwise false
  **/
-static bool bEEP24LC32WritePage(uint16_t u16PageAddress, uint8_t *pu8Data, uint16_t u16DataSize);
+static bool bEEP24LC32WritePage(uint8_t u8SlaveAddress, uint16_t u16PageAddress, uint8_t *pu8Data, uint16_t u16DataSize);
+
+
+/** @brief       This function start the read of a block of data
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [IN]  u16Address     : address of the first byte to read
+  * @param [OUT] pu8Data        : buffer who data will be stored
+  * @param [IN]  u16DataSize    : number of bytes to read
+  * @return      true if the transfer was started, otherwise false
+ **/
+static bool bEEP24LC32ReadBlock(uint8_t u8SlaveAddress, uint16_t u16Address, uint8_t *pu8Data, uint16_t u16DataSize);
+
+
+/** @brief       This function start the read of a block of data at the address pointer of the eeprom, without
+  *              address phase. The address pointer must be known.
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [OUT] pu8Data        : buffer who data will be stored
+  * @param [IN]  u16DataSize    : number of bytes to read
+  * @return      true if the transfer was started, otherwise false
+ **/
+static bool bEEP24LC32ReadCurrent(uint8_t u8SlaveAddress, uint8_t *pu8Data, uint16_t u16DataSize);
+
+
+/** @brief       This function compute the first page of a write operation
+  * @param [IN]  u16StartAddress : address of the first byte to write
+  * @param [IN]  u16DataSize     : number of bytes to write
+  * @return      none
+ **/
+static void vEEP24LC32FirstPage(uint16_t u16StartAddress, uint16_t u16DataSize);
+
+
+/** @brief       This function start the write of the current page of the write operation
+  * @return      none
+ **/
+static void vEEP24LC32StartPage(void);
+
+
+/** @brief       This function read the current page of a fill to know if it already contains the pattern
+  * @return      none
+ **/
+static void vEEP24LC32CheckPage(void);
+
+
+/** @brief       This function start the current page, with a blank check first if it was requested
+  * @return      none
+ **/
+static void vEEP24LC32PageStep(void);
+
+
+/** @brief       This function write the current page of a fill unless the blank check found the pattern
+  * @return      none
+ **/
+static void vEEP24LC32CheckCompleted(void);
+
+
+/** @brief       This function start the read of the source of the current page of a copy
+  * @return      none
+ **/
+static void vEEP24LC32CopyRead(void);
+
+
+/** @brief       This function start the read of the source of the next page of a copy during the write cycle
+  *              of the current page
+  * @return      none
+ **/
+static void vEEP24LC32CopyPrefetch(void);
+
+
+/** @brief       This function start the read of the current chunk of a compare in one of both eeproms
+  * @return      none
+ **/
+static void vEEP24LC32CompareRead(void);
+
+
+/** @brief       This function compare the chunks read in both eeproms and start the next chunk
+  * @return      none
+ **/
+static void vEEP24LC32CompareChunk(void);
+
+
+/** @brief       This function check a copy or a compare request
+  * @param [IN]  psCopy : copy description
+  * @param [IN]  bCopy  : true for a copy, its areas must not overlap when both are in the same eeprom
+  * @return      true if the request can be executed, otherwise false
+ **/
+static bool bEEP24LC32CopyCheck(EEP24LCXXCopy_t *psCopy, bool bCopy);
+
+
+/** @brief       This function check a scattered read request
+  * @param [IN]  psScatter : scattered read description
+  * @return      true if the request can be executed, otherwise false
+ **/
+static bool bEEP24LC32ScatterCheck(EEP24LCXXScatter_t *psScatter);
+
+
+/** @brief       This function plan the transactions of a scattered read with the lowest cost in bit-times
+  * @param [IN]  psScatter : scattered read description
+  * @return      none
+ **/
+static void vEEP24LC32ScatterPlan(EEP24LCXXScatter_t *psScatter);
+
+
+/** @brief       This function start the current transaction of a scattered read
+  * @return      none
+ **/
+static void vEEP24LC32ScatterRun(void);
+
+
+/** @brief       This function dispatch the records of the transaction which has been read and start the next one
+  * @return      none
+ **/
+static void vEEP24LC32ScatterDone(void);
+
+
+/** @brief       This function return the last record of the current transaction of a scattered read
+  * @return      index of the record
+ **/
+static uint8_t u8EEP24LC32ScatterLast(void);
+
+
+/** @brief       This function go to the next page when the current one is done, the next page is started
+  *              directly. The end of the last page is left to the poll function so that it reports it.
+  * @return      none
+ **/
+static void vEEP24LC32PageDone(void);
+
+
+/** @brief       This function compute the next page of the write operation when a page has been written
+  * @return      none
+ **/
+static void vEEP24LC32NextPage(void);
+
+
+/** @brief       This function make the write operation in progress (write, fill or copy) progress of one step
+  * @return      none
+ **/
+static void vEEP24LC32WriteProcess(void);
 
 /** @brief       This function initialize eeprom
   * @param [IN]  eSlaveAddress   : adress of the eeprom
   * @param [IN]  psI2CInst       : pointer to I2C object
   * @param [IN]  psTimerInst     : pointer to a timer object
+  * @param [IN]  pfbStartOneShot : one-shot timer signaling the end of the write cycle, or NULL_PTR
+  * @param [IN]  ePartClass      : voltage class of the eeprom
+  * @param [IN]  eBusClock       : clock of the I2C bus
   * @param [OUT] none
   * @return      none
  **/
-static bool bEEP24LC32Init(eEEP24LCXXAddress_t eSlaveAddress, I2CObj_t  *psI2CInst, sObjTimer_t *psTimerInst);
+static bool bEEP24LC32Init(eEEP24LCXXAddress_t eSlaveAddress, I2CObj_t  *psI2CInst, sObjTimer_t *psTimerInst, EEPOneShotFunc_t pfbStartOneShot, eEEP24LCXXPartClass_t ePartClass, eEEP24LCXXBusClock_t eBusClock);
 
 
 /** @brief       This function wite data in the eeprom
   * @param [IN]  sEEPData : eeprom data
-  * @return      true if write operation was done correctly, otherwise false
+  * @return      true if write operation was done correctly, this end is reported by one call only
  **/
 static bool bEEP24LC32WriteData(EEP24LCXXData_t *sEEPData);
 
 
-/** @brief       This function read data in the eeprom
+/** @brief       This function fill an area of the eeprom with a pattern
+  * @param [IN]  sEEPFill : fill description
+  * @return      true if fill operation was done correctly, this end is reported by one call only
+ **/
+static bool bEEP24LC32FillData(EEP24LCXXFill_t *sEEPFill);
+
+
+/** @brief       This function read data in the eeprom. It must be called until it return true : the end of
+  *              the read is reported by one call only, the next call starts a new read.
   * @param [IN]  sEEPData : eeprom data
   * @return      true if read operation was done correctly, otherwise false
  **/
 static bool bEEP24LC32ReadData(EEP24LCXXData_t *sEEPData);
 
 
+/** @brief       This function read scattered records in the eeprom
+  * @param [IN]  psScatter : scattered read description
+  * @return      true if all records have been read, this end is reported by one call only
+ **/
+static bool bEEP24LC32ReadScattered(EEP24LCXXScatter_t *psScatter);
+
+
 /** @brief       This function is call when error occur during transmission 
   * @return      none
  **/
@@ -181,11 +468,23 @@ static void vEEP24LC32ReceiveHandler(void);
 static void vEEP24LC32TransmitHandler(void);
 
 
+/** @brief       This function is call by the timer at the end of the internal write cycle
+  * @return      none
+ **/
+static void vEEP24LC32WriteCycleHandler(void);
+
+
 /** @brief       This function is list all callback function of eeprom
   * @return      none
  **/
 static void vEEP24LC32Handler(void);
 
+
+/** @brief       This function return the current transfer state of the eeprom
+  * @return      transfer state
+ **/
+static EEPROM24XXTransferState_t eEEP24LC32GetTransferState(void);
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
@@ -196,31 +495,126 @@ static void vEEP24LC32Handler(void);
   * @param [IN]  eSlaveAddress   : adress of the eeprom
   * @param [IN]  psI2CInst       : pointer to I2C object
   * @param [IN]  psTimerInst     : pointer to a timer object
+  * @param [IN]  pfbStartOneShot : one-shot timer signaling the end of the write cycle, or NULL_PTR
+  * @param [IN]  ePartClass      : voltage class of the eeprom
+  * @param [IN]  eBusClock       : clock of the I2C bus
   * @param [OUT] none
   * @return      none
  **/
-static bool bEEP24LC32Init(eEEP24LCXXAddress_t eSlaveAddress, I2CObj_t  *psI2CInst, sObjTimer_t *psTimerInst)
+static bool bEEP24LC32Init(eEEP24LCXXAddress_t eSlaveAddress, I2CObj_t  *psI2CInst, sObjTimer_t *psTimerInst, EEPOneShotFunc_t pfbStartOneShot, eEEP24LCXXPartClass_t ePartClass, eEEP24LCXXBusClock_t eBusClock)
 {   
-   /* check if I2C driver and Timer was initialized */
-   if ((psI2CInst != NULL_PTR) && (psTimerInst != NULL_PTR))
+   /* check if I2C driver and Timer was initialized and if the eeprom supports the bus clock */
+   if ((psI2CInst != NULL_PTR) && (psTimerInst != NULL_PTR) && (ePartClass < EEP24LCXX_PART_MAX) && (eBusClock < EEP24LCXX_BUS_MAX) &&
+       (asBusProfile[eBusClock].u32ClockKHz <= au32PartClockKHz[ePartClass]))
    {
-      sCb.psTimerInst   = psTimerInst; 
+      /* the address pointers are kept while the driver stays on the same bus, the blocking and block device */
+      /* layers bind the object once per operation. Another master must forget them explicitly              */
+      if (sCb.psI2CInst != psI2CInst)
+      {
+        memset(sCb.abPointerValid, false, sizeof(sCb.abPointerValid));
+      }
+
+      sCb.psTimerInst     = psTimerInst; 
+      sCb.pfbStartOneShot = pfbStartOneShot;
       sCb.psI2CInst     = psI2CInst;
       sCb.eAdresse      = eSlaveAddress;
       sCb.eDrvState     = EEPROM_DRIVER_INITIALIZED;
       sCb.eTranferState = EEPROM_STATE_DRIVER_INITIALIZED;
+
+      /* the time between two transfers does not depend on the clock, the faster the bus the more bit-times it costs */
+      sCb.u32TransferBits = (((EEPROM_TRANSFER_START_NS + asBusProfile[eBusClock].u32BusFreeNs) * asBusProfile[eBusClock].u32ClockKHz) + ((EEPROM_NS_PER_SECOND / EEPROM_KHZ) - 1)) / (EEPROM_NS_PER_SECOND / EEPROM_KHZ);
+   }
+   else
+   {
+      /* a previous instance must not stay usable with a clock its eeprom does not support */
+      sCb.eDrvState     = EEPROM_DRIVER_NOT_INITIALIZED;
+      sCb.eTranferState = EEPROM_STATE_DRIVER_NOT_INITIALIZED;
    }
 
    return (EEPROM_DRIVER_INITIALIZED == sCb.eDrvState);
 }
 
 
+/** @brief       This function start the transfer prepared in the control block and keep the address pointer that
+  *              the eeprom will have at its end. The pointer is set first because the transfer can end in the call.
+  *              No transfer is started while the transfer of an aborted operation is still on the bus.
+  * @param [IN]  u16Pointer : address pointer of the eeprom at the end of the transfer
+  * @return      true if the transfer was started, otherwise false
+ **/
+static bool bEEP24LC32StartTransfer(uint16_t u16Pointer)
+{
+  uint8_t u8Cs = sCb.sI2CData.u8SlaveAddress & EEPROM_CS_MSK;
+  bool    bRet = false;
+
+  if (sCb.bTransferPending == false)
+  {
+    sCb.au16AddrPointer[u8Cs] = u16Pointer & EEPROM_ADDR_MAX;
+    sCb.abPointerValid[u8Cs]  = true;
+    sCb.bTransferPending      = true;
+
+    bRet = sCb.psI2CInst->pfbMasterStartTransmit(&sCb.sI2CData);
+
+    if (bRet == false)
+    {
+      sCb.abPointerValid[u8Cs] = false;
+      sCb.bTransferPending     = false;
+    }
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function check if the address pointer of an eeprom is known and equal to an address
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [IN]  u16Address     : address of the next byte to read
+  * @return      true if a current address read can be used, otherwise false
+ **/
+static bool bEEP24LC32AtPointer(uint8_t u8SlaveAddress, uint16_t u16Address)
+{
+  uint8_t u8Cs = u8SlaveAddress & EEPROM_CS_MSK;
+
+  return (sCb.abPointerValid[u8Cs] == true) && (sCb.au16AddrPointer[u8Cs] == u16Address);
+}
+
+
+/** @brief       This function check if an operation has ended without being reported by its poll function yet
+  * @param [IN]  eOperation : operation of the poll function
+  * @param [IN]  eEndState  : state at the end of the operation
+  * @return      true if the operation must not be started again, otherwise false
+ **/
+static bool bEEP24LC32EndPending(EEPROM24XXOperation_t eOperation, EEPROM24XXTransferState_t eEndState)
+{
+  return (sCb.eTranferState == eEndState) && (sCb.eOperation == eOperation) && (sCb.bEndReported == false);
+}
+
+
+/** @brief       This function report the end of an operation once : the operation may end in interrupt, the
+  *              first call of its poll function after the end returns true and the next one starts it again
+  * @param [IN]  eOperation : operation of the poll function
+  * @param [IN]  eEndState  : state at the end of the operation
+  * @return      true if the end of the operation is reported by this call, otherwise false
+ **/
+static bool bEEP24LC32ReportEnd(EEPROM24XXOperation_t eOperation, EEPROM24XXTransferState_t eEndState)
+{
+  bool bRet = bEEP24LC32EndPending(eOperation, eEndState);
+
+  if (bRet == true)
+  {
+    sCb.bEndReported = true;
+  }
+
+  return bRet;
+}
+
+
 /** @brief       This function write a collection of data in a page of the eeprom
+  * @param [IN]  u8SlaveAddress  : slave address of the eeprom
   * @param [IN]  u16PageAddress  : adress of data to write
   * @param [IN]  pu8Data         : data to store
   * @return      true if write operation was done correctly, otherwise false
  **/
-static bool bEEP24LC32WritePage(uint16_t u16PageAddress, uint8_t *pu8Data, uint16_t u16DataSize)
+static bool bEEP24LC32WritePage(uint8_t u8SlaveAddress, uint16_t u16PageAddress, uint8_t *pu8Data, uint16_t u16DataSize)
 {
   bool bRet = false;
 
@@ -228,7 +622,7 @@ static bool bEEP24LC32WritePage(uint16_t u16PageAddress, uint8_t *pu8Data, uint1
   {
     if (((u16DataSize > EEPROM_ZERO) && (u16DataSize <= EEPROM_PAGE_SIZE)) && (u16PageAddress <= EEPROM_ADDR_MAX) && (pu8Data != NULL_PTR))
     {
-      sCb.sI2CData.u8SlaveAddress    = (uint8_t)sCb.eAdresse;
+      sCb.sI2CData.u8SlaveAddress    = u8SlaveAddress;
       sCb.sI2CData.pu8Data           = &pu8Data[0];
       sCb.sI2CData.u16DataLength     = u16DataSize;
       sCb.sI2CData.pu8Cmd[0]         = (uint8_t)EEPROM_HIGH_ADDR(u16PageAddress);
@@ -237,10 +631,11 @@ static bool bEEP24LC32WritePage(uint16_t u16PageAddress, uint8_t *pu8Data, uint1
       sCb.sI2CData.pfvCbkTransmitEnd = vEEP24LC32Handler; 
       sCb.sI2CData.pfvCbkRcv         = vEEP24LC32Handler; 
       sCb.sI2CData.pfvCbkStop        = vEEP24LC32Handler; 
-      sCb.sI2CData.pfvCbkError       = vEEP24LC32Handler; 
+      sCb.sI2CData.pfvCbkError       = vEEP24LC32ErrorHandler;
       sCb.sI2CData.eDirection        = I2C_DIR_WRITE;
 
-      bRet = sCb.psI2CInst->pfbMasterStartTransmit(&sCb.sI2CData);
+      /* the address pointer rolls over inside the page */
+      bRet = bEEP24LC32StartTransfer((u16PageAddress & (uint16_t)~EEPROM_PAGE_MSK) | ((u16PageAddress + u16DataSize) & EEPROM_PAGE_MSK));
     }
   }
 
@@ -248,194 +643,862 @@ static bool bEEP24LC32WritePage(uint16_t u16PageAddress, uint8_t *pu8Data, uint1
 }
 
 
-/** @brief       This function write data in the eeprom
-  * @param [IN]  sEEPData : eeprom data
-  * @return      true if write operation was done correctly, otherwise false
+/** @brief       This function start the read of a block of data
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [IN]  u16Address     : address of the first byte to read
+  * @param [OUT] pu8Data        : buffer who data will be stored
+  * @param [IN]  u16DataSize    : number of bytes to read
+  * @return      true if the transfer was started, otherwise false
  **/
-static bool bEEP24LC32WriteData(EEP24LCXXData_t *sEEPData)
+static bool bEEP24LC32ReadBlock(uint8_t u8SlaveAddress, uint16_t u16Address, uint8_t *pu8Data, uint16_t u16DataSize)
 {
-   static bool     bRet              = false;
-   static uint16_t u16DataSize_m      = EEPROM_ZERO;
-   static uint16_t u16StartAddress_m  = EEPROM_ZERO;
-   static uint16_t u16PageStartAddr   = EEPROM_ZERO;
-   static uint16_t u16PageEndAddr     = EEPROM_ZERO;
-   static uint8_t  u8PageSize         = EEPROM_ZERO;
-   static uint8_t  u8Index            = EEPROM_ZERO;
-   static uint32_t u32WriteTimeOut    = EEPROM_ZERO;
-   
-   if (((sEEPData->u16DataSize > EEPROM_ZERO) && (sEEPData->u16DataSize <= EEPROM_DATA_SIZE_MAX)) && (sEEPData->u16StartAddress <= EEPROM_ADDR_MAX) && (sEEPData->pu8Data != NULL_PTR))
-   {
-      switch(sCb.eTranferState)
-      {
-        case EEPROM_STATE_DRIVER_INITIALIZED : 
-        case EEPROM_STATE_READ_COMPLETED     :
-        case EEPROM_STATE_WRITE_COMPLETED    :
-        case EEPROM_STATE_WRITE_ABORTED      :
-        {
-          /* Initialization of local variables */
-          bRet             = false;
-          u8Index           = EEPROM_ZERO;
-          u16DataSize_m     = sEEPData->u16DataSize;
-          u16StartAddress_m = sEEPData->u16StartAddress;
-          
-          /* Compute the start address of the first page */
-          u16PageStartAddr = (sEEPData->u16StartAddress / EEPROM_PAGE_SIZE) * (EEPROM_PAGE_SIZE);
-
-          /* Compute the number of data to be write in the first page */
-          u8PageSize       = (EEPROM_PAGE_SIZE) - (uint8_t)(sEEPData->u16StartAddress - u16PageStartAddr);
-
-          /* Compute the end address of the first page */
-          u16PageEndAddr   = (sEEPData->u16StartAddress) + (uint16_t)(u8PageSize - 1);
-
-          /* if DataSize < 32 set PageSize to data size */
-          if (u8PageSize > sEEPData->u16DataSize)
-          {
-            u8PageSize = (uint8_t)sEEPData->u16DataSize; 
-          }
-
-          /* set state */
-          sCb.eTranferState = EEPROM_STATE_WRITE_PAGE;
+  sCb.sI2CData.u8SlaveAddress    = u8SlaveAddress;
+  sCb.sI2CData.pu8Data           = &pu8Data[0];
+  sCb.sI2CData.u16DataLength     = u16DataSize;
+  sCb.sI2CData.pu8Cmd[0]         = (uint8_t)EEPROM_HIGH_ADDR(u16Address);
+  sCb.sI2CData.pu8Cmd[1]         = (uint8_t)EEPROM_LOW_ADDR(u16Address);
+  sCb.sI2CData.u8CmdLength       = EEPROM_CMD_LENGHT;
+  sCb.sI2CData.pfvCbkTransmitEnd = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkRcv         = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkStop        = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkError       = vEEP24LC32ErrorHandler;
+  sCb.sI2CData.eDirection        = I2C_DIR_WRITE_READ;
+
+  /* a read rolls over the whole memory */
+  return bEEP24LC32StartTransfer(u16Address + u16DataSize);
+}
 
-          break;
-        }
 
-        case EEPROM_STATE_WRITE_PAGE:
-        {
-          /* storage of user callback functions */
-          sCb.pfvCbkError        = sEEPData->pfvCbkError;
-          sCb.pfvCbkRcv          = sEEPData->pfvCbkRcv;
-          sCb.pfvCbkTransmitEnd  = sEEPData->pfvCbkTransmitEnd;
-          
-          /* set state */
-          sCb.eTranferState = EEPROM_STATE_TRANSFER_IN_PROGRESS;
+/** @brief       This function start the read of a block of data at the address pointer of the eeprom, without
+  *              address phase. The address pointer must be known.
+  * @param [IN]  u8SlaveAddress : slave address of the eeprom
+  * @param [OUT] pu8Data        : buffer who data will be stored
+  * @param [IN]  u16DataSize    : number of bytes to read
+  * @return      true if the transfer was started, otherwise false
+ **/
+static bool bEEP24LC32ReadCurrent(uint8_t u8SlaveAddress, uint8_t *pu8Data, uint16_t u16DataSize)
+{
+  sCb.sI2CData.u8SlaveAddress    = u8SlaveAddress;
+  sCb.sI2CData.pu8Data           = &pu8Data[0];
+  sCb.sI2CData.u16DataLength     = u16DataSize;
+  sCb.sI2CData.u8CmdLength       = EEPROM_ZERO;
+  sCb.sI2CData.pfvCbkTransmitEnd = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkRcv         = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkStop        = vEEP24LC32Handler;
+  sCb.sI2CData.pfvCbkError       = vEEP24LC32ErrorHandler;
+  sCb.sI2CData.eDirection        = I2C_DIR_READ;
+
+  return bEEP24LC32StartTransfer(sCb.au16AddrPointer[u8SlaveAddress & EEPROM_CS_MSK] + u16DataSize);
+}
 
-          /* Write data on the page */
-          if ((u16StartAddress_m + u8PageSize) <= EEPROM_ADDR_MAX)
-          {
-            bRet = bEEP24LC32WritePage(u16StartAddress_m, &sEEPData->pu8Data[u8Index], u8PageSize);
-          }
 
-          if (bRet == false)
-          {
-            /* set state */
-            sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
-          }
+/** @brief       This function compute the first page of a write operation
+  * @param [IN]  u16StartAddress : address of the first byte to write
+  * @param [IN]  u16DataSize     : number of bytes to write
+  * @return      none
+ **/
+static void vEEP24LC32FirstPage(uint16_t u16StartAddress, uint16_t u16DataSize)
+{
+  sCb.u16WriteIndex    = EEPROM_ZERO;
+  sCb.u16WriteSize     = u16DataSize;
+  sCb.u16WriteAddress  = u16StartAddress;
+  sCb.bWriteCycleTimer = false;
+  sCb.bCopyPrefetch    = false;
 
-          break; 
-        }
+  /* Compute the number of data to be write in the first page */
+  sCb.u8PageSize       = (EEPROM_PAGE_SIZE) - (uint8_t)(u16StartAddress % EEPROM_PAGE_SIZE);
 
-        case EEPROM_STATE_TRANSFER_IN_PROGRESS:
-          /* wait until the transfer is completed */
-          break;
+  /* Compute the end address of the first page */
+  sCb.u16PageEndAddr   = u16StartAddress + (uint16_t)(sCb.u8PageSize - 1);
 
-        case EEPROM_STATE_TRANSFER_COMPLETED:
-        {
-          /* set state */
-          sCb.eTranferState = EEPROM_STATE_WAIT_WRITE_CYCLE;
+  /* if DataSize < 32 set PageSize to data size */
+  if (sCb.u8PageSize > u16DataSize)
+  {
+    sCb.u8PageSize = (uint8_t)u16DataSize;
+  }
 
-          /* set TimeOut */
-          u32WriteTimeOut  = (uint32_t)~sCb.psTimerInst->pfu32GetTickMs() + 1;
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_WRITE_PAGE;
+}
 
-          break;
-        }
 
-        case EEPROM_STATE_WAIT_WRITE_CYCLE:
-        {
-          /* wait 5 milliseconds until the chip completed the internal write cycle */
-          if ((sCb.psTimerInst->pfu32GetTickMs() + u32WriteTimeOut) > (uint32_t)(EEPROM_TIME_OUT))
-          {
-            /* set state */
-            sCb.eTranferState = EEPROM_STATE_WRITE_PAGE_COMPLETED;    
-          }
+/** @brief       This function start the write of the current page of the write operation
+  * @return      none
+ **/
+static void vEEP24LC32StartPage(void)
+{
+  bool    bRet     = false;
+  uint8_t *pu8Data = &sCb.au8PageBuffer[0];
 
-          break;
-        }
+  /* a fill always writes the pattern of the page buffer, it may have been overwritten by the blank check */
+  if (sCb.eOperation == EEPROM_OP_FILL)
+  {
+    memset(sCb.au8PageBuffer, sCb.u8FillPattern, sizeof(sCb.au8PageBuffer));
+  }
+  else if (sCb.eOperation == EEPROM_OP_COPY)
+  {
+    /* the page buffer contains the source page, it is free again at the end of the transfer */
+    sCb.bCopyBuffered = false;
+  }
+  else
+  {
+    pu8Data = &sCb.pu8WriteData[sCb.u16WriteIndex];
+  }
 
-        case EEPROM_STATE_WRITE_PAGE_COMPLETED:
-        {
-          /* Sustract to data size the data which has previously writed */
-          u16DataSize_m    -= u8PageSize; 
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_TRANSFER_IN_PROGRESS;
 
-          /* Compute the new start address of the bytes to write */
-          u16StartAddress_m = u16PageEndAddr + 1;
+  /* Write data on the page */
+  if ((sCb.u16WriteAddress + (sCb.u8PageSize - 1)) <= EEPROM_ADDR_MAX)
+  {
+    bRet = bEEP24LC32WritePage(sCb.u8WriteSlave, sCb.u16WriteAddress, pu8Data, sCb.u8PageSize);
+  }
 
-          /* Add previous index to the new index */
-          u8Index          += u8PageSize;
+  if (bRet == false)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+  }
+}
 
-          /* Compute the new page size */
-          if (u16DataSize_m >= EEPROM_PAGE_SIZE)
-          {
-            u8PageSize = EEPROM_PAGE_SIZE;
-          }
-          else
-          {
-            u8PageSize = (uint8_t)u16DataSize_m; 
-          }
-          
-          /* Compute the new page end address */
-          u16PageEndAddr  = u16StartAddress_m + (uint16_t)(u8PageSize - 1);  
 
-          if (u16DataSize_m > EEPROM_ZERO)
-          {
-            /* set state */
-            sCb.eTranferState = EEPROM_STATE_WRITE_PAGE;
-          }
-          else
-          {
-            /* set state */
-            sCb.eTranferState = EEPROM_STATE_WRITE_COMPLETED;           
-          }
-        
-          break;
-        }
+/** @brief       This function read the current page of a fill to know if it already contains the pattern
+  * @return      none
+ **/
+static void vEEP24LC32CheckPage(void)
+{
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_CHECK_IN_PROGRESS;
 
-        default:
-          break;
-      }
-          
-   }
-   
-   return (EEPROM_STATE_WRITE_COMPLETED == sCb.eTranferState);
+  if (bEEP24LC32ReadBlock(sCb.u8WriteSlave, sCb.u16WriteAddress, &sCb.au8PageBuffer[0], sCb.u8PageSize) == false)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+  }
 }
 
 
-/** @brief       This function read data in the eeprom
-  * @param [IN]  sEEPData : eeprom data
-  * @return      true if read operation was done correctly, otherwise false
+/** @brief       This function start the current page, with a blank check first if it was requested
+  * @return      none
  **/
-static bool bEEP24LC32ReadData(EEP24LCXXData_t *sEEPData)
+static void vEEP24LC32PageStep(void)
 {
-  if ((sEEPData->u16DataSize <= EEPROM_DATA_SIZE_MAX) && (sEEPData->u16StartAddress <= EEPROM_ADDR_MAX) && (sEEPData->pu8Data != NULL_PTR))
+  if ((sCb.eOperation == EEPROM_OP_FILL) && (sCb.bSkipBlank == true))
   {
-    switch(sCb.eTranferState)
-    {
-      case EEPROM_STATE_DRIVER_INITIALIZED : 
+    vEEP24LC32CheckPage();
+  }
+  else if ((sCb.eOperation == EEPROM_OP_COPY) && (sCb.bCopyPrefetch == true))
+  {
+    /* the source page is already being read since the previous write cycle, the end of the read starts the page */
+  }
+  else if ((sCb.eOperation == EEPROM_OP_COPY) && (sCb.bCopyBuffered == false))
+  {
+    /* the source page is read first. The prefetch flag is tested before this one : the interrupt sets */
+    /* bCopyBuffered before it clears bCopyPrefetch, so a prefetch which just ended is never read again  */
+    vEEP24LC32CopyRead();
+  }
+  else
+  {
+    vEEP24LC32StartPage();
+  }
+}
+
+
+/** @brief       This function write the current page of a fill unless the blank check found the pattern
+  * @return      none
+ **/
+static void vEEP24LC32CheckCompleted(void)
+{
+  uint8_t u8Index = EEPROM_ZERO;
+
+  while ((u8Index < sCb.u8PageSize) && (sCb.au8PageBuffer[u8Index] == sCb.u8FillPattern))
+  {
+    u8Index++;
+  }
+
+  if (u8Index == sCb.u8PageSize)
+  {
+    /* nothing to write in this page */
+    vEEP24LC32PageDone();
+  }
+  else
+  {
+    vEEP24LC32StartPage();
+  }
+}
+
+
+/** @brief       This function start the read of the source of the current page of a copy
+  * @return      none
+ **/
+static void vEEP24LC32CopyRead(void)
+{
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_COPY_READ_IN_PROGRESS;
+
+  if (bEEP24LC32ReadBlock(sCb.u8ReadSlave, sCb.u16SrcAddress + sCb.u16WriteIndex, &sCb.au8PageBuffer[0], sCb.u8PageSize) == false)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+  }
+}
+
+
+/** @brief       This function start the read of the source of the next page of a copy during the write cycle
+  *              of the current page. It is only possible when the source is another chip, an eeprom does not
+  *              answer during its own write cycle.
+  * @return      none
+ **/
+static void vEEP24LC32CopyPrefetch(void)
+{
+  uint16_t u16NextSize = sCb.u16WriteSize - sCb.u8PageSize;
+
+  if ((sCb.eOperation == EEPROM_OP_COPY) && (sCb.u8ReadSlave != sCb.u8WriteSlave) && (u16NextSize > EEPROM_ZERO))
+  {
+    /* the next destination page is aligned : it is a full page or the end of the data */
+    if (u16NextSize > EEPROM_PAGE_SIZE)
+    {
+      u16NextSize = EEPROM_PAGE_SIZE;
+    }
+
+    /* the flag is set first because the read can end in the call. If the read cannot be started, the */
+    /* source page is read after the write cycle                                                       */
+    sCb.bCopyPrefetch = true;
+
+    if (bEEP24LC32ReadBlock(sCb.u8ReadSlave, sCb.u16SrcAddress + sCb.u16WriteIndex + sCb.u8PageSize, &sCb.au8PageBuffer[0], u16NextSize) == false)
+    {
+      sCb.bCopyPrefetch = false;
+    }
+  }
+}
+
+
+/** @brief       This function start the read of the current chunk of a compare in one of both eeproms
+  * @return      none
+ **/
+static void vEEP24LC32CompareRead(void)
+{
+  bool bRet;
+
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_COPY_READ_IN_PROGRESS;
+
+  if (sCb.bCompareSecond == false)
+  {
+    bRet = bEEP24LC32ReadBlock(sCb.u8ReadSlave, sCb.u16SrcAddress + sCb.u16WriteIndex, &sCb.au8PageBuffer[0], sCb.u8PageSize);
+  }
+  else
+  {
+    bRet = bEEP24LC32ReadBlock(sCb.u8WriteSlave, sCb.u16CmpAddress + sCb.u16WriteIndex, &sCb.au8PageBuffer[EEPROM_COMPARE_CHUNK], sCb.u8PageSize);
+  }
+
+  if (bRet == false)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_READ_ABORTED;
+  }
+}
+
+
+/** @brief       This function compare the chunks read in both eeproms and start the next chunk
+  * @return      none
+ **/
+static void vEEP24LC32CompareChunk(void)
+{
+  uint8_t u8Index = EEPROM_ZERO;
+
+  while ((u8Index < sCb.u8PageSize) && (sCb.au8PageBuffer[u8Index] == sCb.au8PageBuffer[EEPROM_COMPARE_CHUNK + u8Index]))
+  {
+    u8Index++;
+  }
+
+  if (u8Index < sCb.u8PageSize)
+  {
+    /* stop at the first difference */
+    sCb.psCopy->bEqual            = false;
+    sCb.psCopy->u16MismatchOffset = sCb.u16WriteIndex + u8Index;
+    sCb.eTranferState             = EEPROM_STATE_COMPARE_COMPLETED;
+  }
+  else
+  {
+    sCb.u16WriteIndex += sCb.u8PageSize;
+    sCb.u16WriteSize  -= sCb.u8PageSize;
+
+    if (sCb.u16WriteSize == EEPROM_ZERO)
+    {
+      sCb.psCopy->bEqual = true;
+      sCb.eTranferState  = EEPROM_STATE_COMPARE_COMPLETED;
+    }
+    else
+    {
+      sCb.u8PageSize     = (sCb.u16WriteSize > EEPROM_COMPARE_CHUNK) ? EEPROM_COMPARE_CHUNK : (uint8_t)sCb.u16WriteSize;
+      sCb.bCompareSecond = false;
+
+      vEEP24LC32CompareRead();
+    }
+  }
+}
+
+
+/** @brief       This function check a copy or a compare request
+  * @param [IN]  psCopy : copy description
+  * @param [IN]  bCopy  : true for a copy, its areas must not overlap when both are in the same eeprom
+  * @return      true if the request can be executed, otherwise false
+ **/
+static bool bEEP24LC32CopyCheck(EEP24LCXXCopy_t *psCopy, bool bCopy)
+{
+  bool bRet = false;
+
+  if ((psCopy != NULL_PTR) && (psCopy->psSrcEEP != NULL_PTR) && (psCopy->psDstEEP != NULL_PTR) && (sCb.eDrvState == EEPROM_DRIVER_INITIALIZED))
+  {
+    /* both eeproms must be on the bus of the driver and both areas inside the memory */
+    bRet = (psCopy->psSrcEEP->psI2CInst == sCb.psI2CInst) && (psCopy->psDstEEP->psI2CInst == sCb.psI2CInst) &&
+           (psCopy->u16DataSize > EEPROM_ZERO) && (psCopy->u16SrcAddress <= EEPROM_ADDR_MAX) && (psCopy->u16DstAddress <= EEPROM_ADDR_MAX) &&
+           (psCopy->u16DataSize <= (EEPROM_DATA_SIZE_MAX - psCopy->u16SrcAddress)) && (psCopy->u16DataSize <= (EEPROM_DATA_SIZE_MAX - psCopy->u16DstAddress));
+
+    /* a copy goes page by page, overlapping areas of the same eeprom would be overwritten before being read */
+    if ((bRet == true) && (bCopy == true) && (psCopy->psSrcEEP->eEEPSlaveAddress == psCopy->psDstEEP->eEEPSlaveAddress))
+    {
+      bRet = (((uint32_t)psCopy->u16SrcAddress + psCopy->u16DataSize) <= psCopy->u16DstAddress) ||
+             (((uint32_t)psCopy->u16DstAddress + psCopy->u16DataSize) <= psCopy->u16SrcAddress);
+    }
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function check a scattered read request
+  * @param [IN]  psScatter : scattered read description
+  * @return      true if the request can be executed, otherwise false
+ **/
+static bool bEEP24LC32ScatterCheck(EEP24LCXXScatter_t *psScatter)
+{
+  bool              bRet    = false;
+  uint32_t          u32Next = EEPROM_ZERO;
+  uint8_t           u8Index;
+  EEP24LCXXRecord_t *psRec;
+
+  if ((psScatter != NULL_PTR) && (psScatter->psRecords != NULL_PTR) && (psScatter->u8RecordCount > EEPROM_ZERO) &&
+      (psScatter->u8RecordCount <= EEPROM_SCATTER_RECORD_MAX) && (sCb.eDrvState == EEPROM_DRIVER_INITIALIZED))
+  {
+    bRet = true;
+
+    /* the records must be inside the memory, sorted by increasing address and without overlap */
+    for (u8Index = EEPROM_ZERO; (u8Index < psScatter->u8RecordCount) && (bRet == true); u8Index++)
+    {
+      psRec   = &psScatter->psRecords[u8Index];
+      bRet    = (psRec->pu8Data != NULL_PTR) && (psRec->u16DataSize > EEPROM_ZERO) && (psRec->u16Address <= EEPROM_ADDR_MAX) &&
+                (psRec->u16Address >= u32Next) && (psRec->u16DataSize <= (EEPROM_DATA_SIZE_MAX - psRec->u16Address));
+      u32Next = (uint32_t)psRec->u16Address + psRec->u16DataSize;
+    }
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function plan the transactions of a scattered read with the lowest cost in bit-times
+  *              Each transaction reads the records from a first one to a last one. It starts with an address
+  *              phase (random read), or continues at the address pointer left by the previous transaction or
+  *              by the last access of the eeprom (current address read), and the bytes between its records are read and dropped. Such a
+  *              transaction goes through the page buffer, so it cannot read more than a page.
+  * @param [IN]  psScatter : scattered read description
+  * @return      none
+ **/
+static void vEEP24LC32ScatterPlan(EEP24LCXXScatter_t *psScatter)
+{
+  EEP24LCXXRecord_t *psRec = psScatter->psRecords;
+  uint32_t          au32Cost[EEPROM_SCATTER_RECORD_MAX + 1];
+  uint8_t           au8From[EEPROM_SCATTER_RECORD_MAX + 1];
+  bool              abCurrent[EEPROM_SCATTER_RECORD_MAX + 1];
+  uint32_t          u32Cost;
+  uint32_t          u32Start;
+  uint32_t          u32End;
+  uint8_t           u8Cs  = (uint8_t)sCb.eAdresse & EEPROM_CS_MSK;
+  bool              bCurrent;
+  uint8_t           u8First;
+  uint8_t           u8End;
+  uint8_t           u8Run = EEPROM_ZERO;
+
+  /* au32Cost[n] is the cheapest cost to read the n first records, their last transaction reads the */
+  /* records from au8From[n] to n - 1                                                               */
+  au32Cost[0] = EEPROM_ZERO;
+
+  for (u8End = 1; u8End <= psScatter->u8RecordCount; u8End++)
+  {
+    u32End          = (uint32_t)psRec[u8End - 1].u16Address + psRec[u8End - 1].u16DataSize;
+    au32Cost[u8End] = UINT32_MAX;
+
+    for (u8First = EEPROM_ZERO; u8First < u8End; u8First++)
+    {
+      /* random read from the first record */
+      u32Start = psRec[u8First].u16Address;
+      u32Cost  = au32Cost[u8First] + EEPROM_BITS_RANDOM_READ + sCb.u32TransferBits + ((u32End - u32Start) * EEPROM_BITS_PER_BYTE);
+
+      if (((u8First == (u8End - 1)) || ((u32End - u32Start) <= EEPROM_PAGE_SIZE)) && (u32Cost < au32Cost[u8End]))
+      {
+        au32Cost[u8End]  = u32Cost;
+        au8From[u8End]   = u8First;
+        abCurrent[u8End] = false;
+      }
+
+      /* current address read from the end of the record before, or from the known address pointer for the first record */
+      if (u8First > EEPROM_ZERO)
+      {
+        u32Start = (uint32_t)psRec[u8First - 1].u16Address + psRec[u8First - 1].u16DataSize;
+        bCurrent = true;
+      }
+      else
+      {
+        u32Start = sCb.au16AddrPointer[u8Cs];
+        bCurrent = (sCb.abPointerValid[u8Cs] == true) && (u32Start <= psRec[0].u16Address);
+      }
+
+      if (bCurrent == true)
+      {
+        u32Cost  = au32Cost[u8First] + EEPROM_BITS_CURRENT_READ + sCb.u32TransferBits + ((u32End - u32Start) * EEPROM_BITS_PER_BYTE);
+
+        if ((((u8First == (u8End - 1)) && (u32Start == psRec[u8First].u16Address)) || ((u32End - u32Start) <= EEPROM_PAGE_SIZE)) && (u32Cost < au32Cost[u8End]))
+        {
+          au32Cost[u8End]  = u32Cost;
+          au8From[u8End]   = u8First;
+          abCurrent[u8End] = true;
+        }
+      }
+    }
+  }
+
+  /* the transactions are found from the last one */
+  for (u8End = psScatter->u8RecordCount; u8End > EEPROM_ZERO; u8End = au8From[u8End])
+  {
+    u8Run++;
+  }
+
+  sCb.u8RunCount = u8Run;
+
+  for (u8End = psScatter->u8RecordCount; u8End > EEPROM_ZERO; u8End = au8From[u8End])
+  {
+    u8Run--;
+    sCb.au8RunFirst[u8Run]  = au8From[u8End];
+    sCb.abRunCurrent[u8Run] = abCurrent[u8End];
+  }
+
+  psScatter->u32BusBits = au32Cost[psScatter->u8RecordCount];
+}
+
+
+/** @brief       This function return the last record of the current transaction of a scattered read
+  * @return      index of the record
+ **/
+static uint8_t u8EEP24LC32ScatterLast(void)
+{
+  uint8_t u8Last = sCb.psScatter->u8RecordCount - 1;
+
+  if ((sCb.u8RunIndex + 1) < sCb.u8RunCount)
+  {
+    u8Last = sCb.au8RunFirst[sCb.u8RunIndex + 1] - 1;
+  }
+
+  return u8Last;
+}
+
+
+/** @brief       This function start the current transaction of a scattered read
+  * @return      none
+ **/
+static void vEEP24LC32ScatterRun(void)
+{
+  EEP24LCXXRecord_t *psRec  = sCb.psScatter->psRecords;
+  uint8_t           u8First = sCb.au8RunFirst[sCb.u8RunIndex];
+  uint8_t           u8Last  = u8EEP24LC32ScatterLast();
+  uint8_t           *pu8Data;
+  uint16_t          u16Size;
+  bool              bRet;
+
+  if ((sCb.abRunCurrent[sCb.u8RunIndex] == true) && (u8First == EEPROM_ZERO))
+  {
+    sCb.u16RunAddress = sCb.au16AddrPointer[(uint8_t)sCb.eAdresse & EEPROM_CS_MSK];
+  }
+  else if (sCb.abRunCurrent[sCb.u8RunIndex] == true)
+  {
+    sCb.u16RunAddress = psRec[u8First - 1].u16Address + psRec[u8First - 1].u16DataSize;
+  }
+  else
+  {
+    sCb.u16RunAddress = psRec[u8First].u16Address;
+  }
+
+  u16Size = (psRec[u8Last].u16Address + psRec[u8Last].u16DataSize) - sCb.u16RunAddress;
+
+  /* a single record is read directly in the user buffer, otherwise the page buffer is used */
+  sCb.bRunBuffered = (u8First != u8Last) || (sCb.u16RunAddress != psRec[u8First].u16Address);
+  pu8Data          = (sCb.bRunBuffered == true) ? &sCb.au8PageBuffer[0] : psRec[u8First].pu8Data;
+
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_COPY_READ_IN_PROGRESS;
+
+  if (sCb.abRunCurrent[sCb.u8RunIndex] == true)
+  {
+    bRet = bEEP24LC32ReadCurrent((uint8_t)sCb.eAdresse, pu8Data, u16Size);
+  }
+  else
+  {
+    bRet = bEEP24LC32ReadBlock((uint8_t)sCb.eAdresse, sCb.u16RunAddress, pu8Data, u16Size);
+  }
+
+  if (bRet == false)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_READ_ABORTED;
+  }
+}
+
+
+/** @brief       This function dispatch the records of the transaction which has been read and start the next one
+  * @return      none
+ **/
+static void vEEP24LC32ScatterDone(void)
+{
+  EEP24LCXXRecord_t *psRec  = sCb.psScatter->psRecords;
+  uint8_t           u8Last  = u8EEP24LC32ScatterLast();
+  uint8_t           u8Index;
+
+  if (sCb.bRunBuffered == true)
+  {
+    for (u8Index = sCb.au8RunFirst[sCb.u8RunIndex]; u8Index <= u8Last; u8Index++)
+    {
+      memcpy(psRec[u8Index].pu8Data, &sCb.au8PageBuffer[psRec[u8Index].u16Address - sCb.u16RunAddress], psRec[u8Index].u16DataSize);
+    }
+  }
+
+  sCb.u8RunIndex++;
+
+  if (sCb.u8RunIndex < sCb.u8RunCount)
+  {
+    vEEP24LC32ScatterRun();
+  }
+  else
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_READ_COMPLETED;
+  }
+}
+
+
+/** @brief       This function go to the next page when the current one is done, the next page is started
+  *              directly. The end of the last page is left to the poll function so that it reports it.
+  *              A page can be done inside the start of the next one (blank page of a fill with a transfer
+  *              which ends in its start call) : this call is then only noted, and the first call goes on
+  *              in a loop instead of a recursion as deep as the number of pages.
+  * @return      none
+ **/
+static void vEEP24LC32PageDone(void)
+{
+  /* set state */
+  sCb.eTranferState = EEPROM_STATE_WRITE_PAGE_COMPLETED;
+
+  if (sCb.bPageLoop == true)
+  {
+    sCb.bPageAgain = true;
+  }
+  else
+  {
+    sCb.bPageLoop = true;
+
+    do
+    {
+      sCb.bPageAgain = false;
+
+      if (sCb.u16WriteSize > sCb.u8PageSize)
+      {
+        vEEP24LC32NextPage();
+        vEEP24LC32PageStep();
+      }
+    } while (sCb.bPageAgain == true);
+
+    sCb.bPageLoop = false;
+  }
+}
+
+
+/** @brief       This function compute the next page of the write operation when a page has been written
+  * @return      none
+ **/
+static void vEEP24LC32NextPage(void)
+{
+  /* Sustract to data size the data which has previously writed */
+  sCb.u16WriteSize    -= sCb.u8PageSize;
+
+  /* Compute the new start address of the bytes to write */
+  sCb.u16WriteAddress  = sCb.u16PageEndAddr + 1;
+
+  /* Add previous index to the new index */
+  sCb.u16WriteIndex   += sCb.u8PageSize;
+
+  /* Compute the new page size */
+  if (sCb.u16WriteSize >= EEPROM_PAGE_SIZE)
+  {
+    sCb.u8PageSize = EEPROM_PAGE_SIZE;
+  }
+  else
+  {
+    sCb.u8PageSize = (uint8_t)sCb.u16WriteSize;
+  }
+
+  /* Compute the new page end address */
+  sCb.u16PageEndAddr  = sCb.u16WriteAddress + (uint16_t)(sCb.u8PageSize - 1);
+
+  if (sCb.u16WriteSize > EEPROM_ZERO)
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_WRITE_PAGE;
+  }
+  else
+  {
+    /* set state */
+    sCb.eTranferState = EEPROM_STATE_WRITE_COMPLETED;
+  }
+}
+
+
+/** @brief       This function make the write operation in progress (write, fill or copy) progress until it
+  *              waits for the bus or for the write cycle
+  * @return      none
+ **/
+static void vEEP24LC32WriteProcess(void)
+{
+  EEPROM24XXTransferState_t eState;
+
+  /* the steps which do not wait follow each other in the same call, the next page is started as soon as */
+  /* the write cycle is over and not one poll later                                                       */
+  do
+  {
+    eState = sCb.eTranferState;
+
+    switch(eState)
+    {
+      case EEPROM_STATE_WRITE_PAGE:
+      {
+        /* after a write cycle signaled by the timer, the page is started from the interrupt only */
+        if (sCb.bWriteCycleTimer == false)
+        {
+          vEEP24LC32PageStep();
+        }
+        break;
+      }
+
+      case EEPROM_STATE_TRANSFER_IN_PROGRESS:
+      case EEPROM_STATE_CHECK_IN_PROGRESS:
+      case EEPROM_STATE_COPY_READ_IN_PROGRESS:
+        /* wait until the transfer is completed */
+        break;
+
+      case EEPROM_STATE_COPY_READ_COMPLETED:
+      {
+        vEEP24LC32StartPage();
+        break;
+      }
+
+      case EEPROM_STATE_CHECK_COMPLETED:
+      {
+        vEEP24LC32CheckCompleted();
+        break;
+      }
+
+      case EEPROM_STATE_TRANSFER_COMPLETED:
+      {
+        /* set state, the write cycle is timed from the end of the transfer */
+        sCb.eTranferState = EEPROM_STATE_WAIT_WRITE_CYCLE;
+        break;
+      }
+
+      case EEPROM_STATE_WAIT_WRITE_CYCLE:
+      {
+        /* wait 5 milliseconds until the chip completed the internal write cycle, unless the timer signals it */
+        if ((sCb.bWriteCycleTimer == false) && ((sCb.psTimerInst->pfu32GetTickMs() + sCb.u32WriteTimeOut) > (uint32_t)(EEPROM_TIME_OUT)))
+        {
+          /* set state */
+          sCb.eTranferState = EEPROM_STATE_WRITE_PAGE_COMPLETED;
+        }
+
+        break;
+      }
+
+      case EEPROM_STATE_WRITE_PAGE_COMPLETED:
+      {
+        vEEP24LC32NextPage();
+        break;
+      }
+
+      default:
+        break;
+    }
+  } while (sCb.eTranferState != eState);
+}
+
+
+/** @brief       This function write data in the eeprom
+  * @param [IN]  sEEPData : eeprom data
+  * @return      true if write operation was done correctly, this end is reported by one call only
+ **/
+static bool bEEP24LC32WriteData(EEP24LCXXData_t *sEEPData)
+{
+   if (((sEEPData->u16DataSize > EEPROM_ZERO) && (sEEPData->u16DataSize <= EEPROM_DATA_SIZE_MAX)) && (sEEPData->u16StartAddress <= EEPROM_ADDR_MAX) && (sEEPData->pu8Data != NULL_PTR))
+   {
+      switch(sCb.eTranferState)
+      {
+        case EEPROM_STATE_DRIVER_INITIALIZED :
+        case EEPROM_STATE_READ_COMPLETED     :
+        case EEPROM_STATE_READ_ABORTED       :
+        case EEPROM_STATE_WRITE_COMPLETED    :
+        case EEPROM_STATE_WRITE_ABORTED      :
+        case EEPROM_STATE_COMPARE_COMPLETED  :
+        {
+          /* the write may end in interrupt : a write which has not been reported yet is not started again */
+          if (bEEP24LC32EndPending(EEPROM_OP_WRITE, EEPROM_STATE_WRITE_COMPLETED) == true)
+          {
+            break;
+          }
+
+          /* Storage of the write operation, the pages are written from the control block */
+          sCb.pu8WriteData       = sEEPData->pu8Data;
+          sCb.eOperation         = EEPROM_OP_WRITE;
+          sCb.bEndReported       = false;
+          sCb.u8WriteSlave       = (uint8_t)sCb.eAdresse;
+
+          /* storage of user callback functions */
+          sCb.pfvCbkError        = sEEPData->pfvCbkError;
+          sCb.pfvCbkRcv          = sEEPData->pfvCbkRcv;
+          sCb.pfvCbkTransmitEnd  = sEEPData->pfvCbkTransmitEnd;
+
+          vEEP24LC32FirstPage(sEEPData->u16StartAddress, sEEPData->u16DataSize);
+          break;
+        }
+
+        default:
+          /* only the write in progress is driven, not an operation started by another function */
+          if (sCb.eOperation == EEPROM_OP_WRITE)
+          {
+            vEEP24LC32WriteProcess();
+          }
+          break;
+      }
+
+   }
+
+   return bEEP24LC32ReportEnd(EEPROM_OP_WRITE, EEPROM_STATE_WRITE_COMPLETED);
+}
+
+
+/** @brief       This function fill an area of the eeprom with a pattern
+  * @param [IN]  sEEPFill : fill description
+  * @return      true if fill operation was done correctly, this end is reported by one call only
+ **/
+static bool bEEP24LC32FillData(EEP24LCXXFill_t *sEEPFill)
+{
+   if ((sEEPFill->u16DataSize > EEPROM_ZERO) && (sEEPFill->u16StartAddress <= EEPROM_ADDR_MAX) && (sEEPFill->u16DataSize <= (EEPROM_DATA_SIZE_MAX - sEEPFill->u16StartAddress)))
+   {
+      switch(sCb.eTranferState)
+      {
+        case EEPROM_STATE_DRIVER_INITIALIZED :
+        case EEPROM_STATE_READ_COMPLETED     :
+        case EEPROM_STATE_READ_ABORTED       :
+        case EEPROM_STATE_WRITE_COMPLETED    :
+        case EEPROM_STATE_WRITE_ABORTED      :
+        case EEPROM_STATE_COMPARE_COMPLETED  :
+        {
+          /* a fill which has not been reported yet is not started again */
+          if (bEEP24LC32EndPending(EEPROM_OP_FILL, EEPROM_STATE_WRITE_COMPLETED) == true)
+          {
+            break;
+          }
+
+          /* the same page buffer is written in each page, no user buffer is needed */
+          sCb.pu8WriteData       = NULL_PTR;
+          sCb.eOperation         = EEPROM_OP_FILL;
+          sCb.bEndReported       = false;
+          sCb.u8WriteSlave       = (uint8_t)sCb.eAdresse;
+          sCb.bSkipBlank         = sEEPFill->bSkipBlank;
+          sCb.u8FillPattern      = sEEPFill->u8Pattern;
+
+          /* storage of user callback functions */
+          sCb.pfvCbkError        = sEEPFill->pfvCbkError;
+          sCb.pfvCbkRcv          = NULL_PTR;
+          sCb.pfvCbkTransmitEnd  = sEEPFill->pfvCbkTransmitEnd;
+
+          vEEP24LC32FirstPage(sEEPFill->u16StartAddress, sEEPFill->u16DataSize);
+          break;
+        }
+
+        default:
+          if (sCb.eOperation == EEPROM_OP_FILL)
+          {
+            vEEP24LC32WriteProcess();
+          }
+          break;
+      }
+
+   }
+
+   return bEEP24LC32ReportEnd(EEPROM_OP_FILL, EEPROM_STATE_WRITE_COMPLETED);
+}
+
+
+/** @brief       This function read data in the eeprom. It must be called until it return true : the end of
+  *              the read is reported by one call only, the next call starts a new read.
+  * @param [IN]  sEEPData : eeprom data
+  * @return      true if read operation was done correctly, otherwise false
+ **/
+static bool bEEP24LC32ReadData(EEP24LCXXData_t *sEEPData)
+{
+  bool bRet = false;
+  bool bStarted;
+
+  if ((sEEPData->u16DataSize <= EEPROM_DATA_SIZE_MAX) && (sEEPData->u16StartAddress <= EEPROM_ADDR_MAX) && (sEEPData->pu8Data != NULL_PTR))
+  {
+    switch(sCb.eTranferState)
+    {
       case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_DRIVER_INITIALIZED : 
+      case EEPROM_STATE_READ_ABORTED       :
       case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      case EEPROM_STATE_COMPARE_COMPLETED  :
       {
+        /* the read ends in interrupt : a read which has not been reported yet is not started again */
+        if (bEEP24LC32EndPending(EEPROM_OP_READ, EEPROM_STATE_READ_COMPLETED) == true)
+        {
+          break;
+        }
+
+        sCb.eOperation                 = EEPROM_OP_READ;
+        sCb.bEndReported               = false;
+        sCb.bCopyPrefetch              = false;
+
         /* storage of user callback functions */
         sCb.pfvCbkError                = sEEPData->pfvCbkError;
         sCb.pfvCbkRcv                  = sEEPData->pfvCbkRcv;
         sCb.pfvCbkTransmitEnd          = sEEPData->pfvCbkTransmitEnd;
 
-        /* storage of i2c datas */
-        sCb.sI2CData.u8SlaveAddress    = (uint8_t)sCb.eAdresse;
-        sCb.sI2CData.pu8Data           = sEEPData->pu8Data;
-        sCb.sI2CData.u16DataLength     = sEEPData->u16DataSize;
-        sCb.sI2CData.pu8Cmd[0]         = (uint8_t)EEPROM_HIGH_ADDR(sEEPData->u16StartAddress);
-        sCb.sI2CData.pu8Cmd[1]         = (uint8_t)EEPROM_LOW_ADDR(sEEPData->u16StartAddress);
-        sCb.sI2CData.u8CmdLength       = EEPROM_CMD_LENGHT;
-        sCb.sI2CData.pfvCbkTransmitEnd = vEEP24LC32Handler; 
-        sCb.sI2CData.pfvCbkRcv         = vEEP24LC32Handler; 
-        sCb.sI2CData.pfvCbkStop        = vEEP24LC32Handler; 
-        sCb.sI2CData.pfvCbkError       = vEEP24LC32Handler; 
-        sCb.sI2CData.eDirection        = I2C_DIR_WRITE_READ;
-
         /* set transfer state to tranfer in progress */
         sCb.eTranferState = EEPROM_STATE_READ_IN_PROGRESS;
         
-        /* start of data reception */
-        sCb.psI2CInst->pfbMasterStartTransmit(&sCb.sI2CData);
+        /* start of data reception, without address phase when the eeprom already points to the first byte */
+        if (bEEP24LC32AtPointer((uint8_t)sCb.eAdresse, sEEPData->u16StartAddress) == true)
+        {
+          bStarted = bEEP24LC32ReadCurrent((uint8_t)sCb.eAdresse, sEEPData->pu8Data, sEEPData->u16DataSize);
+        }
+        else
+        {
+          bStarted = bEEP24LC32ReadBlock((uint8_t)sCb.eAdresse, sEEPData->u16StartAddress, sEEPData->pu8Data, sEEPData->u16DataSize);
+        }
+
+        /* the bus refused the transfer, no callback will end the read */
+        if (bStarted == false)
+        {
+          sCb.eTranferState = EEPROM_STATE_READ_ABORTED;
+        }
         break;
       }
 
@@ -448,9 +1511,73 @@ static bool bEEP24LC32ReadData(EEP24LCXXData_t *sEEPData)
 
     }
 
+    /* the read may also have ended in the start call */
+    bRet = bEEP24LC32ReportEnd(EEPROM_OP_READ, EEPROM_STATE_READ_COMPLETED);
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function read scattered records in the eeprom
+  * @param [IN]  psScatter : scattered read description
+  * @return      true if all records have been read, this end is reported by one call only
+ **/
+static bool bEEP24LC32ReadScattered(EEP24LCXXScatter_t *psScatter)
+{
+  bool bRet = false;
+
+  if (bEEP24LC32ScatterCheck(psScatter) == true)
+  {
+    switch(sCb.eTranferState)
+    {
+      case EEPROM_STATE_DRIVER_INITIALIZED :
+      case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_READ_ABORTED       :
+      case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      case EEPROM_STATE_COMPARE_COMPLETED  :
+      {
+        /* a scattered read which has not been reported yet is not started again */
+        if (bEEP24LC32EndPending(EEPROM_OP_SCATTER, EEPROM_STATE_READ_COMPLETED) == true)
+        {
+          break;
+        }
+
+        sCb.eOperation         = EEPROM_OP_SCATTER;
+        sCb.bEndReported       = false;
+        sCb.psScatter          = psScatter;
+        sCb.bCopyPrefetch      = false;
+        sCb.u8RunIndex         = EEPROM_ZERO;
+
+        /* storage of user callback functions */
+        sCb.pfvCbkError        = psScatter->pfvCbkError;
+        sCb.pfvCbkRcv          = NULL_PTR;
+        sCb.pfvCbkTransmitEnd  = NULL_PTR;
+
+        vEEP24LC32ScatterPlan(psScatter);
+        vEEP24LC32ScatterRun();
+        break;
+      }
+
+      case EEPROM_STATE_COPY_READ_COMPLETED:
+      {
+        if (sCb.eOperation == EEPROM_OP_SCATTER)
+        {
+          vEEP24LC32ScatterDone();
+        }
+        break;
+      }
+
+      default:
+        /* we wait until the transaction is received */
+        break;
+    }
+
+    bRet = bEEP24LC32ReportEnd(EEPROM_OP_SCATTER, EEPROM_STATE_READ_COMPLETED);
   }
 
-  return (EEPROM_STATE_READ_COMPLETED == sCb.eTranferState);
+  return bRet;
 }
 
 
@@ -459,11 +1586,27 @@ static bool bEEP24LC32ReadData(EEP24LCXXData_t *sEEPData)
  **/
 static void vEEP24LC32TransmitHandler(void)
 {
-  /* we count the number of transmited byte */
-  if(sCb.sI2CData.u8TxIndex == sCb.sI2CData.u16DataLength)
+  /* we count the number of transmited byte, a callback without page write in progress is ignored */
+  if ((sCb.sI2CData.u8TxIndex == sCb.sI2CData.u16DataLength) && (sCb.eTranferState == EEPROM_STATE_TRANSFER_IN_PROGRESS))
   {
-    /* set the flag when all data were transmitted */
-    sCb.eTranferState = EEPROM_STATE_TRANSFER_COMPLETED;
+    /* the write cycle starts now */
+    sCb.u32WriteTimeOut = (uint32_t)~sCb.psTimerInst->pfu32GetTickMs() + 1;
+
+    if (sCb.pfbStartOneShot != NULL_PTR)
+    {
+      /* the timer will wake up the driver when the write cycle is over. One more millisecond is added */
+      /* because the timer can expire up to one tick early                                               */
+      sCb.eTranferState    = EEPROM_STATE_WAIT_WRITE_CYCLE;
+      sCb.bWriteCycleTimer = sCb.pfbStartOneShot(EEPROM_TIME_OUT + 1, vEEP24LC32WriteCycleHandler);
+    }
+    else
+    {
+      /* set the flag when all data were transmitted */
+      sCb.eTranferState = EEPROM_STATE_TRANSFER_COMPLETED;
+    }
+
+    /* a copy reads the next source page while the destination is busy with its write cycle */
+    vEEP24LC32CopyPrefetch();
 
     /* call of transmit callback function */
     if (sCb.pfvCbkTransmitEnd != NULL_PTR)
@@ -474,13 +1617,71 @@ static void vEEP24LC32TransmitHandler(void)
 }
 
 
+/** @brief       This function is call by the timer at the end of the internal write cycle
+  * @return      none
+ **/
+static void vEEP24LC32WriteCycleHandler(void)
+{
+  if (sCb.eTranferState == EEPROM_STATE_WAIT_WRITE_CYCLE)
+  {
+    /* start the next page directly from the interrupt, the user does not need to poll */
+    vEEP24LC32PageDone();
+  }
+}
+
+
 /** @brief       This function is call for each byte transmited by the eeprom 
   * @return      none
  **/
 static void vEEP24LC32ReceiveHandler(void)
 {
   /* we count the number of received byte during the tranfer */
-  if (sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength)
+  if ((sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength) && (sCb.bCopyPrefetch == true))
+  {
+    /* the source of the next page of a copy is ready, the buffer flag is set first (see vEEP24LC32PageStep) */
+    sCb.bCopyBuffered = true;
+    sCb.bCopyPrefetch = false;
+
+    /* the write cycle may already be over. When the timer signaled it, the interrupt owns the page and */
+    /* starts it, otherwise the poll function does                                                      */
+    if ((sCb.eTranferState == EEPROM_STATE_WRITE_PAGE) && (sCb.bWriteCycleTimer == true))
+    {
+      vEEP24LC32StartPage();
+    }
+  }
+  else if ((sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength) && (sCb.eTranferState == EEPROM_STATE_COPY_READ_IN_PROGRESS))
+  {
+    /* a chunk of a copy or a compare has been read */
+    sCb.eTranferState = EEPROM_STATE_COPY_READ_COMPLETED;
+
+    if (sCb.eOperation == EEPROM_OP_COPY)
+    {
+      sCb.bCopyBuffered = true;
+
+      /* with the event driven write cycle the copy goes on from the interrupt */
+      if (sCb.pfbStartOneShot != NULL_PTR)
+      {
+        vEEP24LC32StartPage();
+      }
+    }
+    else if ((sCb.eOperation == EEPROM_OP_SCATTER) && ((sCb.u8RunIndex + 1) < sCb.u8RunCount) && (sCb.pfbStartOneShot != NULL_PTR))
+    {
+      /* the next transaction of a scattered read is started from the interrupt, the last one is left to the poll function */
+      vEEP24LC32ScatterDone();
+    }
+  }
+  else if ((sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength) && (sCb.eTranferState == EEPROM_STATE_CHECK_IN_PROGRESS))
+  {
+    /* the blank check of a fill page is completed */
+    sCb.eTranferState = EEPROM_STATE_CHECK_COMPLETED;
+
+    /* with the event driven write cycle the fill goes on from the interrupt */
+    if (sCb.pfbStartOneShot != NULL_PTR)
+    {
+      vEEP24LC32CheckCompleted();
+    }
+  }
+  else if ((sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength) && (sCb.eTranferState == EEPROM_STATE_READ_IN_PROGRESS))
   {
     /* all datas have been received */
     sCb.eTranferState = EEPROM_STATE_READ_COMPLETED;
@@ -499,13 +1700,53 @@ static void vEEP24LC32ReceiveHandler(void)
  **/
 static void vEEP24LC32ErrorHandler(void)
 {
-  /* set state */
-  sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+  bool bPending;
+
+  switch (sCb.eTranferState)
+  {
+    case EEPROM_STATE_READ_IN_PROGRESS      :
+    case EEPROM_STATE_TRANSFER_IN_PROGRESS  :
+    case EEPROM_STATE_CHECK_IN_PROGRESS     :
+    case EEPROM_STATE_COPY_READ_IN_PROGRESS :
+      bPending = true;
+      break;
+
+    default:
+      /* the prefetch of a copy runs during the write cycle */
+      bPending = sCb.bCopyPrefetch;
+      break;
+  }
+
+  /* an error ends the transfer of the operation in progress or the transfer left on the bus by an aborted operation,
+     a stray error must not clear the pending flag of a transfer still on the bus */
+  if ((bPending == true) || (sCb.bTransferAborted == true))
+  {
+    sCb.bTransferPending = false;
+    sCb.bTransferAborted = false;
+  }
 
-  /* call of error callback function */
-  if (sCb.pfvCbkError != NULL_PTR)
+  /* an error without transfer in progress is ignored, it would abort an operation already completed */
+  if (bPending == true)
   {
-    sCb.pfvCbkError();
+    /* the transfer may have been stopped anywhere, the address pointer of the eeprom is no more known */
+    sCb.abPointerValid[sCb.sI2CData.u8SlaveAddress & EEPROM_CS_MSK] = false;
+    sCb.bCopyPrefetch = false;
+
+    /* set state, an operation which does not write the eeprom is a read */
+    if ((sCb.eOperation == EEPROM_OP_READ) || (sCb.eOperation == EEPROM_OP_SCATTER) || (sCb.eOperation == EEPROM_OP_COMPARE))
+    {
+      sCb.eTranferState = EEPROM_STATE_READ_ABORTED;
+    }
+    else
+    {
+      sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+    }
+
+    /* call of error callback function */
+    if (sCb.pfvCbkError != NULL_PTR)
+    {
+      sCb.pfvCbkError();
+    }
   }
 }
 
@@ -515,24 +1756,45 @@ static void vEEP24LC32ErrorHandler(void)
  **/
 static void vEEP24LC32Handler(void)
 {
+  /* the end of the transfer is noted first because the handlers can start the next one */
   switch(sCb.psI2CInst->pfeGetTransferState())
   {
     case I2C_STATE_TRANSFER_COMPLETED:
+      if ((sCb.sI2CData.eDirection == I2C_DIR_WRITE) && (sCb.sI2CData.u8TxIndex == sCb.sI2CData.u16DataLength))
+      {
+        sCb.bTransferPending = false;
+        sCb.bTransferAborted = false;
+      }
       vEEP24LC32TransmitHandler();
       break;
 
     case I2C_STATE_RECEIVE_CONDITION:
+      if ((sCb.sI2CData.eDirection != I2C_DIR_WRITE) && (sCb.sI2CData.u8RxIndex == sCb.sI2CData.u16DataLength))
+      {
+        sCb.bTransferPending = false;
+        sCb.bTransferAborted = false;
+      }
       vEEP24LC32ReceiveHandler();
       break;
 
     case I2C_STATE_NACK_DETECTION:
       vEEP24LC32ErrorHandler();
+      break;
 
     default:
       break;
   }
 }
 
+
+/** @brief       This function return the current transfer state of the eeprom
+  * @return      transfer state
+ **/
+static EEPROM24XXTransferState_t eEEP24LC32GetTransferState(void)
+{
+  return sCb.eTranferState;
+}
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                                    P U B L I C  F U N C T I O N                                                  *
@@ -544,23 +1806,197 @@ bool bEEP24LCXXInitInst(EEP24LCXXObj_t *sEEPObj)
 {
   bool bRet = false;
 
-  bRet = bEEP24LC32Init(sEEPObj->eEEPSlaveAddress, sEEPObj->psI2CInst, sEEPObj->psTimerInst);
+  bRet = bEEP24LC32Init(sEEPObj->eEEPSlaveAddress, sEEPObj->psI2CInst, sEEPObj->psTimerInst, sEEPObj->pfbStartOneShot, sEEPObj->eEEPPartClass, sEEPObj->eEEPBusClock);
 
   if (bRet == true)
   {
     sEEPObj->pfbEEPWriteData = bEEP24LC32WriteData;
     sEEPObj->pfbEEPReadData  = bEEP24LC32ReadData;
+    sEEPObj->pfbEEPFillData  = bEEP24LC32FillData;
+    sEEPObj->pfbEEPReadScattered = bEEP24LC32ReadScattered;
+    sEEPObj->pfeEEPGetTransferState = eEEP24LC32GetTransferState;
   }
   else
   {
     sEEPObj->pfbEEPWriteData = NULL_PTR;
     sEEPObj->pfbEEPReadData  = NULL_PTR;
+    sEEPObj->pfbEEPFillData  = NULL_PTR;
+    sEEPObj->pfbEEPReadScattered = NULL_PTR;
+    sEEPObj->pfeEEPGetTransferState = NULL_PTR;
   }
 
   return bRet;
 }
 
 
+void vEEP24LCXXForgetPointer(eEEP24LCXXAddress_t eSlaveAddress)
+{
+  sCb.abPointerValid[(uint8_t)eSlaveAddress & EEPROM_CS_MSK] = false;
+}
+
+
+bool bEEP24LCXXAbort(void)
+{
+  switch(sCb.eTranferState)
+  {
+    case EEPROM_STATE_DRIVER_NOT_INITIALIZED :
+    case EEPROM_STATE_DRIVER_INITIALIZED     :
+    case EEPROM_STATE_READ_COMPLETED         :
+    case EEPROM_STATE_READ_ABORTED           :
+    case EEPROM_STATE_WRITE_COMPLETED        :
+    case EEPROM_STATE_WRITE_ABORTED          :
+    case EEPROM_STATE_COMPARE_COMPLETED      :
+      /* no operation in progress */
+      break;
+
+    default:
+    {
+      /* the callbacks of the transfer still on the bus and the write cycle timer find no operation to go on */
+      sCb.bCopyPrefetch = false;
+
+      if ((sCb.eOperation == EEPROM_OP_READ) || (sCb.eOperation == EEPROM_OP_SCATTER) || (sCb.eOperation == EEPROM_OP_COMPARE))
+      {
+        sCb.eTranferState = EEPROM_STATE_READ_ABORTED;
+      }
+      else
+      {
+        sCb.eTranferState = EEPROM_STATE_WRITE_ABORTED;
+      }
+      break;
+    }
+  }
+
+  /* the transfer may be stopped anywhere by the HAL, its end or its error is still awaited */
+  if (sCb.bTransferPending == true)
+  {
+    sCb.abPointerValid[sCb.sI2CData.u8SlaveAddress & EEPROM_CS_MSK] = false;
+    sCb.bTransferAborted = true;
+  }
+
+  return (sCb.bTransferPending == false);
+}
+
+
+bool bEEP24LCXXCopyData(EEP24LCXXCopy_t *psCopy)
+{
+  if (bEEP24LC32CopyCheck(psCopy, true) == true)
+  {
+    switch(sCb.eTranferState)
+    {
+      case EEPROM_STATE_DRIVER_INITIALIZED :
+      case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_READ_ABORTED       :
+      case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      case EEPROM_STATE_COMPARE_COMPLETED  :
+      {
+        /* a copy which has not been reported yet is not started again */
+        if (bEEP24LC32EndPending(EEPROM_OP_COPY, EEPROM_STATE_WRITE_COMPLETED) == true)
+        {
+          break;
+        }
+
+        /* the pages go through the page buffer, no user buffer is needed */
+        sCb.pu8WriteData       = NULL_PTR;
+        sCb.eOperation         = EEPROM_OP_COPY;
+        sCb.bEndReported       = false;
+        sCb.u8WriteSlave       = (uint8_t)psCopy->psDstEEP->eEEPSlaveAddress;
+        sCb.u8ReadSlave        = (uint8_t)psCopy->psSrcEEP->eEEPSlaveAddress;
+        sCb.u16SrcAddress      = psCopy->u16SrcAddress;
+        sCb.bCopyBuffered      = false;
+        sCb.bCopyPrefetch      = false;
+
+        /* storage of user callback functions */
+        sCb.pfvCbkError        = psCopy->pfvCbkError;
+        sCb.pfvCbkRcv          = NULL_PTR;
+        sCb.pfvCbkTransmitEnd  = NULL_PTR;
+
+        vEEP24LC32FirstPage(psCopy->u16DstAddress, psCopy->u16DataSize);
+        break;
+      }
+
+      default:
+        if (sCb.eOperation == EEPROM_OP_COPY)
+        {
+          vEEP24LC32WriteProcess();
+        }
+        break;
+    }
+  }
+
+  return bEEP24LC32ReportEnd(EEPROM_OP_COPY, EEPROM_STATE_WRITE_COMPLETED);
+}
+
+
+bool bEEP24LCXXCompareData(EEP24LCXXCopy_t *psCopy)
+{
+  if (bEEP24LC32CopyCheck(psCopy, false) == true)
+  {
+    switch(sCb.eTranferState)
+    {
+      case EEPROM_STATE_DRIVER_INITIALIZED :
+      case EEPROM_STATE_READ_COMPLETED     :
+      case EEPROM_STATE_READ_ABORTED       :
+      case EEPROM_STATE_WRITE_COMPLETED    :
+      case EEPROM_STATE_WRITE_ABORTED      :
+      case EEPROM_STATE_COMPARE_COMPLETED  :
+      {
+        /* a compare which has not been reported yet is not started again, its result is kept */
+        if (bEEP24LC32EndPending(EEPROM_OP_COMPARE, EEPROM_STATE_COMPARE_COMPLETED) == true)
+        {
+          break;
+        }
+
+        /* each chunk is read in both eeproms, in each half of the page buffer */
+        sCb.eOperation         = EEPROM_OP_COMPARE;
+        sCb.bEndReported       = false;
+        sCb.bCopyPrefetch      = false;
+        sCb.psCopy             = psCopy;
+        sCb.u8ReadSlave        = (uint8_t)psCopy->psSrcEEP->eEEPSlaveAddress;
+        sCb.u8WriteSlave       = (uint8_t)psCopy->psDstEEP->eEEPSlaveAddress;
+        sCb.u16SrcAddress      = psCopy->u16SrcAddress;
+        sCb.u16CmpAddress      = psCopy->u16DstAddress;
+        sCb.u16WriteIndex      = EEPROM_ZERO;
+        sCb.u16WriteSize       = psCopy->u16DataSize;
+        sCb.u8PageSize         = (psCopy->u16DataSize > EEPROM_COMPARE_CHUNK) ? EEPROM_COMPARE_CHUNK : (uint8_t)psCopy->u16DataSize;
+        sCb.bCompareSecond     = false;
+        psCopy->bEqual         = false;
+        psCopy->u16MismatchOffset = EEPROM_ZERO;
+
+        /* storage of user callback functions */
+        sCb.pfvCbkError        = psCopy->pfvCbkError;
+        sCb.pfvCbkRcv          = NULL_PTR;
+        sCb.pfvCbkTransmitEnd  = NULL_PTR;
+
+        vEEP24LC32CompareRead();
+        break;
+      }
+
+      case EEPROM_STATE_COPY_READ_COMPLETED:
+      {
+        /* the chunk may belong to another operation (copy or scattered read) */
+        if ((sCb.eOperation == EEPROM_OP_COMPARE) && (sCb.bCompareSecond == false))
+        {
+          sCb.bCompareSecond = true;
+          vEEP24LC32CompareRead();
+        }
+        else if (sCb.eOperation == EEPROM_OP_COMPARE)
+        {
+          vEEP24LC32CompareChunk();
+        }
+        break;
+      }
+
+      default:
+        /* we wait until the chunk is received */
+        break;
+    }
+  }
+
+  return bEEP24LC32ReportEnd(EEPROM_OP_COMPARE, EEPROM_STATE_COMPARE_COMPLETED);
+}
+
+
 /********************************************************************************************************************
  *                                                                                                                  *
  *                                          E N D   OF  M O D U L E                                                 *
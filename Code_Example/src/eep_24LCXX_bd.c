@@ -0,0 +1,362 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX_bd.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the block device adapter of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+*@remarks
+*		The blocks are contiguous areas of the eeprom starting at u16BaseAddress. A prog is made of whole
+*		pages, so the page state machine of the driver writes each page in one transfer. A read is made of
+*		transfers of one page at most, the receive index of the I2C driver counts 255 bytes only.
+*
+********************************************************************************************************************/
+
+
+#include "eep_24LCXX_bd.h"
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                             D E F I N I T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_BD_ZERO                          0
+#define EEP_BD_READ_SIZE                     (uint32_t)(1)        /* an eeprom is read byte per byte */
+#define EEP_BD_LOOKAHEAD_ALIGN               (uint32_t)(8)        /* littlefs lookahead size is a multiple of 8 bytes */
+#define EEP_BD_BITS_PER_BYTE                 (uint32_t)(8)
+#define EEP_BD_DRAIN_MS                      (uint32_t)(35)       /* longest wait for the end of a lost transfer, SMBus timeout of the HAL */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function check an area of a block and compute its address in the eeprom
+  * @param [IN]  psBd         : block device
+  * @param [IN]  u32Block     : block of the area
+  * @param [IN]  u32Offset    : offset of the area in the block
+  * @param [IN]  u32Size      : size of the area
+  * @param [OUT] pu16Address  : address of the area in the eeprom
+  * @return      true if the area is inside the block, otherwise false
+ **/
+static bool bEEP24LCXXBdArea(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, uint32_t u32Size, uint16_t *pu16Address);
+
+
+/** @brief       This function run a driver operation until it is completed, aborted or timed out
+  * @param [IN]  psBd   : block device
+  * @param [IN]  bWrite : true for a write operation, false for a read operation
+  * @param [IN]  psData : eeprom data
+  * @return      EEP_BD_OK if the operation was done correctly, otherwise EEP_BD_ERR_IO
+ **/
+static int32_t i32EEP24LCXXBdRun(EEP24LCXXBd_t *psBd, bool bWrite, EEP24LCXXData_t *psData);
+
+
+#if defined(EEP_BD_LITTLEFS)
+
+/** @brief       littlefs read callback
+ **/
+static int iEEP24LCXXLfsRead(const struct lfs_config *psCfg, lfs_block_t uBlock, lfs_off_t uOffset, void *pvBuffer, lfs_size_t uSize);
+
+
+/** @brief       littlefs prog callback
+ **/
+static int iEEP24LCXXLfsProg(const struct lfs_config *psCfg, lfs_block_t uBlock, lfs_off_t uOffset, const void *pvBuffer, lfs_size_t uSize);
+
+
+/** @brief       littlefs erase callback
+ **/
+static int iEEP24LCXXLfsErase(const struct lfs_config *psCfg, lfs_block_t uBlock);
+
+
+/** @brief       littlefs sync callback
+ **/
+static int iEEP24LCXXLfsSync(const struct lfs_config *psCfg);
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function check an area of a block and compute its address in the eeprom
+  * @param [IN]  psBd         : block device
+  * @param [IN]  u32Block     : block of the area
+  * @param [IN]  u32Offset    : offset of the area in the block
+  * @param [IN]  u32Size      : size of the area
+  * @param [OUT] pu16Address  : address of the area in the eeprom
+  * @return      true if the area is inside the block, otherwise false
+ **/
+static bool bEEP24LCXXBdArea(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, uint32_t u32Size, uint16_t *pu16Address)
+{
+  bool bRet = false;
+
+  if ((psBd != NULL_PTR) && (psBd->psEEPObj != NULL_PTR) && (u32Block < psBd->u16BlockCount) &&
+      (u32Size > EEP_BD_ZERO) && (u32Offset < psBd->u16BlockSize) && (u32Size <= (psBd->u16BlockSize - u32Offset)))
+  {
+    *pu16Address = (uint16_t)(psBd->u16BaseAddress + (u32Block * psBd->u16BlockSize) + u32Offset);
+    bRet         = true;
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function run a driver operation until it is completed, aborted or timed out
+  * @param [IN]  psBd   : block device
+  * @param [IN]  bWrite : true for a write operation, false for a read operation
+  * @param [IN]  psData : eeprom data
+  * @return      EEP_BD_OK if the operation was done correctly, otherwise EEP_BD_ERR_IO
+ **/
+static int32_t i32EEP24LCXXBdRun(EEP24LCXXBd_t *psBd, bool bWrite, EEP24LCXXData_t *psData)
+{
+#if defined(EEP_BD_BLOCKING)
+
+  bool bDone;
+
+  /* the task sleeps during the transfers and the write cycles, the bus mutex is shared with the other users */
+  if (bWrite == true)
+  {
+    bDone = bEEP24LCXXWriteBlocking(psBd->psEEPObj, psData, psBd->u32TimeOutMs);
+  }
+  else
+  {
+    bDone = bEEP24LCXXReadBlocking(psBd->psEEPObj, psData, psBd->u32TimeOutMs);
+  }
+
+#else
+
+  EEP24LCXXObj_t *psEEPObj = psBd->psEEPObj;
+  bool           bDone     = false;
+  bool           bAbort    = false;
+  bool           bStarted  = false;
+  uint32_t       u32StartMs;
+
+  /* the driver handles one eeprom at a time, bind it to the eeprom of the block device */
+  if (bEEP24LCXXInitInst(psEEPObj) == true)
+  {
+    u32StartMs = psEEPObj->psTimerInst->pfu32GetTickMs();
+
+    while ((bDone == false) && (bAbort == false))
+    {
+      switch (psEEPObj->pfeEEPGetTransferState())
+      {
+        case EEPROM_STATE_READ_ABORTED  :
+        case EEPROM_STATE_WRITE_ABORTED :
+          /* the state is checked first because the operation restarts from an aborted state,
+             the state left by a previous operation is ignored */
+          bAbort = bStarted;
+          break;
+
+        default:
+          break;
+      }
+
+      if ((bAbort == false) && (bWrite == true))
+      {
+        bDone = psEEPObj->pfbEEPWriteData(psData);
+      }
+      else if (bAbort == false)
+      {
+        bDone = psEEPObj->pfbEEPReadData(psData);
+      }
+
+      bStarted = true;
+
+      if ((bDone == false) && ((psEEPObj->psTimerInst->pfu32GetTickMs() - u32StartMs) > psBd->u32TimeOutMs))
+      {
+        bAbort = true;
+      }
+      else if (bDone == false)
+      {
+        /* the core sleeps until the next interrupt : end of transfer, one-shot or tick of the timer */
+        __WFI();
+      }
+      else
+      {
+        /* operation completed */
+      }
+    }
+
+    /* the operation is aborted, the transfer of a timed out operation may still be on the bus and must end
+       before the next one starts */
+    if (bDone == false)
+    {
+      u32StartMs = psEEPObj->psTimerInst->pfu32GetTickMs();
+
+      while ((bEEP24LCXXAbort() == false) && ((psEEPObj->psTimerInst->pfu32GetTickMs() - u32StartMs) <= EEP_BD_DRAIN_MS))
+      {
+        __WFI();
+      }
+    }
+  }
+
+#endif
+
+  return (bDone == true) ? EEP_BD_OK : EEP_BD_ERR_IO;
+}
+
+
+#if defined(EEP_BD_LITTLEFS)
+
+/** @brief       littlefs read callback
+ **/
+static int iEEP24LCXXLfsRead(const struct lfs_config *psCfg, lfs_block_t uBlock, lfs_off_t uOffset, void *pvBuffer, lfs_size_t uSize)
+{
+  return (int)i32EEP24LCXXBdRead((EEP24LCXXBd_t *)psCfg->context, uBlock, uOffset, pvBuffer, uSize);
+}
+
+
+/** @brief       littlefs prog callback
+ **/
+static int iEEP24LCXXLfsProg(const struct lfs_config *psCfg, lfs_block_t uBlock, lfs_off_t uOffset, const void *pvBuffer, lfs_size_t uSize)
+{
+  return (int)i32EEP24LCXXBdProg((EEP24LCXXBd_t *)psCfg->context, uBlock, uOffset, pvBuffer, uSize);
+}
+
+
+/** @brief       littlefs erase callback
+ **/
+static int iEEP24LCXXLfsErase(const struct lfs_config *psCfg, lfs_block_t uBlock)
+{
+  return (int)i32EEP24LCXXBdErase((EEP24LCXXBd_t *)psCfg->context, uBlock);
+}
+
+
+/** @brief       littlefs sync callback
+ **/
+static int iEEP24LCXXLfsSync(const struct lfs_config *psCfg)
+{
+  return (int)i32EEP24LCXXBdSync((EEP24LCXXBd_t *)psCfg->context);
+}
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+bool bEEP24LCXXBdInit(EEP24LCXXBd_t *psBd)
+{
+  bool bRet = false;
+
+  if ((psBd != NULL_PTR) && (psBd->psEEPObj != NULL_PTR))
+  {
+    /* the blocks are made of whole caches, the caches of whole pages, and all blocks are inside the eeprom */
+    bRet = (psBd->u16CacheSize > EEP_BD_ZERO) && ((psBd->u16CacheSize % EEPROM_PAGE_SIZE) == EEP_BD_ZERO) &&
+           (psBd->u16BlockSize > EEP_BD_ZERO) && ((psBd->u16BlockSize % psBd->u16CacheSize) == EEP_BD_ZERO) &&
+           (psBd->u16BlockCount > EEP_BD_ZERO) && ((psBd->u16BaseAddress % EEPROM_PAGE_SIZE) == EEP_BD_ZERO) &&
+           (((uint32_t)psBd->u16BlockSize * psBd->u16BlockCount) <= ((uint32_t)EEPROM_DATA_SIZE_MAX - psBd->u16BaseAddress));
+
+    if (bRet == true)
+    {
+      bRet = bEEP24LCXXInitInst(psBd->psEEPObj);
+    }
+  }
+
+  return bRet;
+}
+
+
+int32_t i32EEP24LCXXBdRead(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, void *pvBuffer, uint32_t u32Size)
+{
+  int32_t         i32Ret = EEP_BD_ERR_INVAL;
+  EEP24LCXXData_t sData  = {EEP_BD_ZERO};
+
+  if ((pvBuffer != NULL_PTR) && (bEEP24LCXXBdArea(psBd, u32Block, u32Offset, u32Size, &sData.u16StartAddress) == true))
+  {
+    sData.pu8Data = (uint8_t *)pvBuffer;
+    i32Ret        = EEP_BD_OK;
+
+    /* one page per transfer, the next ones continue from the address pointer without address phase */
+    while ((u32Size > EEP_BD_ZERO) && (i32Ret == EEP_BD_OK))
+    {
+      sData.u16DataSize = (u32Size > EEPROM_PAGE_SIZE) ? EEPROM_PAGE_SIZE : (uint16_t)u32Size;
+
+      i32Ret = i32EEP24LCXXBdRun(psBd, false, &sData);
+
+      sData.u16StartAddress += sData.u16DataSize;
+      sData.pu8Data         += sData.u16DataSize;
+      u32Size               -= sData.u16DataSize;
+    }
+  }
+
+  return i32Ret;
+}
+
+
+int32_t i32EEP24LCXXBdProg(EEP24LCXXBd_t *psBd, uint32_t u32Block, uint32_t u32Offset, const void *pvBuffer, uint32_t u32Size)
+{
+  int32_t         i32Ret = EEP_BD_ERR_INVAL;
+  EEP24LCXXData_t sData  = {EEP_BD_ZERO};
+
+  /* whole pages only, the driver then writes each page in one transfer without read back */
+  if ((pvBuffer != NULL_PTR) && ((u32Offset % EEPROM_PAGE_SIZE) == EEP_BD_ZERO) && ((u32Size % EEPROM_PAGE_SIZE) == EEP_BD_ZERO) &&
+      (bEEP24LCXXBdArea(psBd, u32Block, u32Offset, u32Size, &sData.u16StartAddress) == true))
+  {
+    /* the driver does not modify the data it writes */
+    sData.pu8Data     = (uint8_t *)pvBuffer;
+    sData.u16DataSize = (uint16_t)u32Size;
+
+    i32Ret = i32EEP24LCXXBdRun(psBd, true, &sData);
+  }
+
+  return i32Ret;
+}
+
+
+int32_t i32EEP24LCXXBdErase(EEP24LCXXBd_t *psBd, uint32_t u32Block)
+{
+  int32_t i32Ret = EEP_BD_ERR_INVAL;
+
+  if ((psBd != NULL_PTR) && (u32Block < psBd->u16BlockCount))
+  {
+    /* an eeprom page is overwritten directly */
+    i32Ret = EEP_BD_OK;
+  }
+
+  return i32Ret;
+}
+
+
+int32_t i32EEP24LCXXBdSync(EEP24LCXXBd_t *psBd)
+{
+  return (psBd != NULL_PTR) ? EEP_BD_OK : EEP_BD_ERR_INVAL;
+}
+
+
+#if defined(EEP_BD_LITTLEFS)
+
+void vEEP24LCXXBdLfsConfig(EEP24LCXXBd_t *psBd, struct lfs_config *psCfg)
+{
+  psCfg->context        = psBd;
+  psCfg->read           = iEEP24LCXXLfsRead;
+  psCfg->prog           = iEEP24LCXXLfsProg;
+  psCfg->erase          = iEEP24LCXXLfsErase;
+  psCfg->sync           = iEEP24LCXXLfsSync;
+  psCfg->read_size      = EEP_BD_READ_SIZE;
+  psCfg->prog_size      = EEPROM_PAGE_SIZE;
+  psCfg->block_size     = psBd->u16BlockSize;
+  psCfg->block_count    = psBd->u16BlockCount;
+  psCfg->cache_size     = psBd->u16CacheSize;
+  psCfg->block_cycles   = EEP_BD_BLOCK_CYCLES;
+
+  /* one bit per block, rounded up to the alignment of the lookahead buffer */
+  psCfg->lookahead_size = ((psBd->u16BlockCount + ((EEP_BD_LOOKAHEAD_ALIGN * EEP_BD_BITS_PER_BYTE) - 1)) /
+                           (EEP_BD_LOOKAHEAD_ALIGN * EEP_BD_BITS_PER_BYTE)) * EEP_BD_LOOKAHEAD_ALIGN;
+}
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                          E N D   OF  M O D U L E                                                 *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,694 @@
+/********************************************************************************************************************
+* @file		eep_24LCXX_blob.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the compressed blob api of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+*@remarks
+*		Bit stream : a literal is a 1 followed by the byte (9 bits), a match is a 0 followed by the distance
+*		minus 1 (8 bits) and the length minus 2 (4 bits). The stream is most significant bit first and the
+*		last byte is padded with zeros. The header is the first 5 bytes of the stream : magic, size of the
+*		data and CRC-16/CCITT of the data (most significant byte first). The CRC is computed before the write
+*		and checked at the end of the decompression, so a blob whose write was cut is not read back.
+*		The stream is cut at the page boundaries, so that each chunk is written or read in one transfer.
+*
+********************************************************************************************************************/
+
+
+#include "eep_24LCXX_blob.h"
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                             D E F I N I T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_BLOB_ZERO                        0
+#define EEP_BLOB_MAGIC                       (uint32_t)(0x5A)
+#define EEP_BLOB_BYTE_BITS                   (uint8_t)(8)
+#define EEP_BLOB_BYTE_MSK                    (uint32_t)(0xFF)
+#define EEP_BLOB_CRC_INIT                    (uint16_t)(0xFFFF)
+#define EEP_BLOB_CRC_POLY                    (uint16_t)(0x1021)
+#define EEP_BLOB_CRC_MSB                     (uint16_t)(0x8000)
+#define EEP_BLOB_WINDOW_BITS                 (uint8_t)(8)
+#define EEP_BLOB_WINDOW_SIZE                 (uint16_t)(1 << EEP_BLOB_WINDOW_BITS)
+#define EEP_BLOB_COUNT_BITS                  (uint8_t)(4)
+#define EEP_BLOB_COUNT_MSK                   (uint32_t)((1 << EEP_BLOB_COUNT_BITS) - 1)
+#define EEP_BLOB_MATCH_MIN                   (uint16_t)(2)
+#define EEP_BLOB_MATCH_MAX                   (uint16_t)(EEP_BLOB_MATCH_MIN + EEP_BLOB_COUNT_MSK)
+#define EEP_BLOB_LITERAL_BITS                (uint8_t)(1 + EEP_BLOB_BYTE_BITS)
+#define EEP_BLOB_MATCH_BITS                  (uint8_t)(1 + EEP_BLOB_WINDOW_BITS + EEP_BLOB_COUNT_BITS)
+
+#define EEP_BLOB_INIT                        {                                        \
+                                               .eState       = EEP_BLOB_IDLE,         \
+                                               .psBlob       = NULL_PTR,              \
+                                               .u16Index     = EEP_BLOB_ZERO,         \
+                                               .u32Bits      = EEP_BLOB_ZERO,         \
+                                               .u8BitCount   = EEP_BLOB_ZERO,         \
+                                               .bHeader      = false,                 \
+                                               .u8HeaderPos  = EEP_BLOB_ZERO,         \
+                                               .au8Header    = {EEP_BLOB_ZERO},       \
+                                               .u16Crc       = EEP_BLOB_ZERO,         \
+                                               .u16Address   = EEP_BLOB_ZERO,         \
+                                               .u8ChunkLen   = EEP_BLOB_ZERO,         \
+                                               .u8ChunkPos   = EEP_BLOB_ZERO,         \
+                                               .bChunkReady  = false,                 \
+                                               .au8Chunk     = {EEP_BLOB_ZERO}        \
+                                             }
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N U M E R A T I O N                                                     *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** blob operation state */
+enum EEPROMBlobState
+{
+  EEP_BLOB_IDLE  = 0,
+  EEP_BLOB_WRITE = 1,
+  EEP_BLOB_READ  = 2,
+
+  EEP_BLOB_STATE_MAX
+};
+
+typedef enum EEPROMBlobState EEPROMBlobState_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** control block of the blob api */
+struct EEPROMBlob
+{
+  EEPROMBlobState_t   eState;                 ///< operation in progress
+  EEP24LCXXBlob_t     *psBlob;                ///< user structure of the operation
+  EEP24LCXXData_t     sData;                  ///< transfer of the current chunk
+  uint16_t            u16Index;               ///< next byte of the user buffer to compress or to decompress
+  uint32_t            u32Bits;                ///< bits of the stream which are not yet in a chunk or not yet decoded
+  uint8_t             u8BitCount;             ///< number of bits in u32Bits
+  bool                bHeader;                ///< read : the header has been decoded
+  uint8_t             u8HeaderPos;            ///< next byte of the header to write or to read
+  uint8_t             au8Header[EEP_BLOB_HEADER_SIZE]; ///< header, too long for u32Bits
+  uint16_t            u16Crc;                 ///< read : CRC of the decompressed bytes
+  uint16_t            u16Address;             ///< address of the current chunk
+  uint8_t             u8ChunkLen;             ///< number of bytes of the current chunk
+  uint8_t             u8ChunkPos;             ///< read : next byte of the chunk to decode
+  bool                bChunkReady;            ///< the end of the chunk write or read has been reported by the driver
+  uint8_t             au8Chunk[EEPROM_PAGE_SIZE]; ///< current chunk of the stream
+};
+
+typedef struct EEPROMBlob EEPROMBlob_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                      P R I V A T E  V A R I A B L E                                              *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** blob api control block variable */
+static EEPROMBlob_t sBlob = EEP_BLOB_INIT;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function add bits at the end of the stream
+  * @param [IN]  u32Value : bits to add, right aligned
+  * @param [IN]  u8Count  : number of bits to add
+  * @return      none
+ **/
+static void vEEP24LCXXBlobPutBits(uint32_t u32Value, uint8_t u8Count);
+
+
+/** @brief       This function take bits at the beginning of the stream
+  * @param [IN]  u8Count : number of bits to take, they must be available
+  * @return      bits, right aligned
+ **/
+static uint32_t u32EEP24LCXXBlobGetBits(uint8_t u8Count);
+
+
+/** @brief       This function add a byte to a CRC-16/CCITT
+  * @param [IN]  u16Crc : current CRC
+  * @param [IN]  u8Byte : byte to add
+  * @return      new CRC
+ **/
+static uint16_t u16EEP24LCXXBlobCrc(uint16_t u16Crc, uint8_t u8Byte);
+
+
+/** @brief       This function add a decompressed byte to the user buffer and to the CRC
+  * @param [IN]  u8Byte : decompressed byte
+  * @return      none
+ **/
+static void vEEP24LCXXBlobOutput(uint8_t u8Byte);
+
+
+/** @brief       This function compress the next bytes of the user buffer in one literal or one match
+  * @return      none
+ **/
+static void vEEP24LCXXBlobEncode(void);
+
+
+/** @brief       This function decode the current chunk into the user buffer
+  * @return      true if the stream is valid, otherwise false
+ **/
+static bool bEEP24LCXXBlobDecode(void);
+
+
+/** @brief       This function compute the size of the chunk at the current address, it stops at the end of
+  *              the page and at the end of the capacity of the blob
+  * @return      size of the chunk, 0 when the capacity is full
+ **/
+static uint8_t u8EEP24LCXXBlobChunkSize(void);
+
+
+/** @brief       This function fill the next chunk with the stream and start its write
+  * @return      true if the write was started, otherwise false
+ **/
+static bool bEEP24LCXXBlobNextWrite(void);
+
+
+/** @brief       This function start the read of the next chunk of the stream
+  * @return      true if the read was started, otherwise false
+ **/
+static bool bEEP24LCXXBlobNextRead(void);
+
+
+/** @brief       This function end the operation in progress
+  * @param [IN]  bAborted : true if the operation failed
+  * @return      none
+ **/
+static void vEEP24LCXXBlobEnd(bool bAborted);
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function add bits at the end of the stream
+  * @param [IN]  u32Value : bits to add, right aligned
+  * @param [IN]  u8Count  : number of bits to add
+  * @return      none
+ **/
+static void vEEP24LCXXBlobPutBits(uint32_t u32Value, uint8_t u8Count)
+{
+  sBlob.u32Bits     = (sBlob.u32Bits << u8Count) | (u32Value & ((1UL << u8Count) - 1));
+  sBlob.u8BitCount += u8Count;
+}
+
+
+/** @brief       This function take bits at the beginning of the stream
+  * @param [IN]  u8Count : number of bits to take, they must be available
+  * @return      bits, right aligned
+ **/
+static uint32_t u32EEP24LCXXBlobGetBits(uint8_t u8Count)
+{
+  uint32_t u32Value;
+
+  sBlob.u8BitCount -= u8Count;
+  u32Value          = (sBlob.u32Bits >> sBlob.u8BitCount) & ((1UL << u8Count) - 1);
+  sBlob.u32Bits    &= (1UL << sBlob.u8BitCount) - 1;
+
+  return u32Value;
+}
+
+
+/** @brief       This function add a byte to a CRC-16/CCITT
+  * @param [IN]  u16Crc : current CRC
+  * @param [IN]  u8Byte : byte to add
+  * @return      new CRC
+ **/
+static uint16_t u16EEP24LCXXBlobCrc(uint16_t u16Crc, uint8_t u8Byte)
+{
+  uint8_t u8Bit;
+
+  u16Crc ^= (uint16_t)((uint16_t)u8Byte << EEP_BLOB_BYTE_BITS);
+
+  for (u8Bit = EEP_BLOB_ZERO; u8Bit < EEP_BLOB_BYTE_BITS; u8Bit++)
+  {
+    u16Crc = ((u16Crc & EEP_BLOB_CRC_MSB) != EEP_BLOB_ZERO) ? (uint16_t)((u16Crc << 1) ^ EEP_BLOB_CRC_POLY) : (uint16_t)(u16Crc << 1);
+  }
+
+  return u16Crc;
+}
+
+
+/** @brief       This function add a decompressed byte to the user buffer and to the CRC
+  * @param [IN]  u8Byte : decompressed byte
+  * @return      none
+ **/
+static void vEEP24LCXXBlobOutput(uint8_t u8Byte)
+{
+  sBlob.psBlob->pu8Data[sBlob.u16Index] = u8Byte;
+  sBlob.u16Crc                          = u16EEP24LCXXBlobCrc(sBlob.u16Crc, u8Byte);
+  sBlob.u16Index++;
+}
+
+
+/** @brief       This function compress the next bytes of the user buffer in one literal or one match
+  * @return      none
+ **/
+static void vEEP24LCXXBlobEncode(void)
+{
+  uint8_t  *pu8Data   = sBlob.psBlob->pu8Data;
+  uint16_t u16Index   = sBlob.u16Index;
+  uint16_t u16Max     = sBlob.psBlob->u16DataSize - u16Index;
+  uint16_t u16BestLen = EEP_BLOB_ZERO;
+  uint16_t u16BestDist = EEP_BLOB_ZERO;
+  uint16_t u16Dist;
+  uint16_t u16Len;
+
+  if (u16Max > EEP_BLOB_MATCH_MAX)
+  {
+    u16Max = EEP_BLOB_MATCH_MAX;
+  }
+
+  /* longest match in the window, the closest one when several have the same length */
+  for (u16Dist = 1; (u16Dist <= EEP_BLOB_WINDOW_SIZE) && (u16Dist <= u16Index) && (u16BestLen < u16Max); u16Dist++)
+  {
+    u16Len = EEP_BLOB_ZERO;
+
+    while ((u16Len < u16Max) && (pu8Data[u16Index - u16Dist + u16Len] == pu8Data[u16Index + u16Len]))
+    {
+      u16Len++;
+    }
+
+    if (u16Len > u16BestLen)
+    {
+      u16BestLen  = u16Len;
+      u16BestDist = u16Dist;
+    }
+  }
+
+  if (u16BestLen >= EEP_BLOB_MATCH_MIN)
+  {
+    vEEP24LCXXBlobPutBits(EEP_BLOB_ZERO, 1);
+    vEEP24LCXXBlobPutBits(u16BestDist - 1, EEP_BLOB_WINDOW_BITS);
+    vEEP24LCXXBlobPutBits(u16BestLen - EEP_BLOB_MATCH_MIN, EEP_BLOB_COUNT_BITS);
+    sBlob.u16Index += u16BestLen;
+  }
+  else
+  {
+    vEEP24LCXXBlobPutBits(1, 1);
+    vEEP24LCXXBlobPutBits(pu8Data[u16Index], EEP_BLOB_BYTE_BITS);
+    sBlob.u16Index++;
+  }
+}
+
+
+/** @brief       This function decode the current chunk into the user buffer
+  * @return      true if the stream is valid, otherwise false
+ **/
+static bool bEEP24LCXXBlobDecode(void)
+{
+  EEP24LCXXBlob_t *psBlob = sBlob.psBlob;
+  bool            bRet    = true;
+  bool            bMore   = true;
+  uint8_t         u8Need;
+  uint16_t        u16Size;
+  uint16_t        u16Dist;
+  uint16_t        u16Len;
+
+  while ((bRet == true) && (bMore == true) && ((sBlob.bHeader == false) || (sBlob.u16Index < psBlob->u16DataSize)))
+  {
+    /* number of bits of the next element : flag, literal or match, the header is read byte per byte */
+    if (sBlob.bHeader == false)
+    {
+      u8Need = EEP_BLOB_ZERO;
+    }
+    else if (sBlob.u8BitCount == EEP_BLOB_ZERO)
+    {
+      u8Need = 1;
+    }
+    else
+    {
+      u8Need = (((sBlob.u32Bits >> (sBlob.u8BitCount - 1)) & 1) == 1) ? EEP_BLOB_LITERAL_BITS : EEP_BLOB_MATCH_BITS;
+    }
+
+    if ((sBlob.bHeader == false) && (sBlob.u8HeaderPos < EEP_BLOB_HEADER_SIZE) && (sBlob.u8ChunkPos < sBlob.u8ChunkLen))
+    {
+      sBlob.au8Header[sBlob.u8HeaderPos] = sBlob.au8Chunk[sBlob.u8ChunkPos];
+      sBlob.u8HeaderPos++;
+      sBlob.u8ChunkPos++;
+    }
+    else if ((sBlob.u8BitCount < u8Need) && (sBlob.u8ChunkPos < sBlob.u8ChunkLen))
+    {
+      vEEP24LCXXBlobPutBits(sBlob.au8Chunk[sBlob.u8ChunkPos], EEP_BLOB_BYTE_BITS);
+      sBlob.u8ChunkPos++;
+    }
+    else if ((sBlob.u8BitCount < u8Need) || (sBlob.u8HeaderPos < EEP_BLOB_HEADER_SIZE))
+    {
+      /* the next chunk is needed */
+      bMore = false;
+    }
+    else if (sBlob.bHeader == false)
+    {
+      /* the buffer of the user must receive the whole data */
+      u16Size       = (uint16_t)(((uint16_t)sBlob.au8Header[1] << EEP_BLOB_BYTE_BITS) | sBlob.au8Header[2]);
+      sBlob.bHeader = true;
+      bRet          = (sBlob.au8Header[0] == EEP_BLOB_MAGIC) && (u16Size > EEP_BLOB_ZERO) && (u16Size <= psBlob->u16DataSize);
+
+      if (bRet == true)
+      {
+        psBlob->u16DataSize = u16Size;
+      }
+    }
+    else if (u8Need == EEP_BLOB_LITERAL_BITS)
+    {
+      vEEP24LCXXBlobOutput((uint8_t)(u32EEP24LCXXBlobGetBits(EEP_BLOB_LITERAL_BITS) & EEP_BLOB_BYTE_MSK));
+    }
+    else
+    {
+      /* the match is copied byte per byte since it can overlap the bytes it produces */
+      (void)u32EEP24LCXXBlobGetBits(1);
+      u16Dist = (uint16_t)u32EEP24LCXXBlobGetBits(EEP_BLOB_WINDOW_BITS) + 1;
+      u16Len  = (uint16_t)u32EEP24LCXXBlobGetBits(EEP_BLOB_COUNT_BITS) + EEP_BLOB_MATCH_MIN;
+      bRet    = (u16Dist <= sBlob.u16Index) && (u16Len <= (psBlob->u16DataSize - sBlob.u16Index));
+
+      while ((bRet == true) && (u16Len > EEP_BLOB_ZERO))
+      {
+        vEEP24LCXXBlobOutput(psBlob->pu8Data[sBlob.u16Index - u16Dist]);
+        u16Len--;
+      }
+    }
+  }
+
+  /* the whole data has been decompressed, it must be the data which was written */
+  if ((bRet == true) && (sBlob.bHeader == true) && (sBlob.u16Index == psBlob->u16DataSize))
+  {
+    bRet = (sBlob.u16Crc == (uint16_t)(((uint16_t)sBlob.au8Header[3] << EEP_BLOB_BYTE_BITS) | sBlob.au8Header[4]));
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function compute the size of the chunk at the current address, it stops at the end of
+  *              the page and at the end of the capacity of the blob
+  * @return      size of the chunk, 0 when the capacity is full
+ **/
+static uint8_t u8EEP24LCXXBlobChunkSize(void)
+{
+  uint32_t u32End  = (uint32_t)sBlob.psBlob->u16Address + sBlob.psBlob->u16Capacity;
+  uint32_t u32Size = EEPROM_PAGE_SIZE - (sBlob.u16Address % EEPROM_PAGE_SIZE);
+
+  if ((sBlob.u16Address + u32Size) > u32End)
+  {
+    u32Size = (u32End > sBlob.u16Address) ? (u32End - sBlob.u16Address) : EEP_BLOB_ZERO;
+  }
+
+  return (uint8_t)u32Size;
+}
+
+
+/** @brief       This function fill the next chunk with the stream and start its write
+  * @return      true if the write was started, otherwise false
+ **/
+static bool bEEP24LCXXBlobNextWrite(void)
+{
+  uint8_t u8Size = u8EEP24LCXXBlobChunkSize();
+
+  sBlob.u8ChunkLen = EEP_BLOB_ZERO;
+
+  while ((sBlob.u8ChunkLen < u8Size) &&
+         ((sBlob.u8HeaderPos < EEP_BLOB_HEADER_SIZE) || (sBlob.u16Index < sBlob.psBlob->u16DataSize) || (sBlob.u8BitCount > EEP_BLOB_ZERO)))
+  {
+    if (sBlob.u8HeaderPos < EEP_BLOB_HEADER_SIZE)
+    {
+      /* the header is the beginning of the stream */
+      sBlob.au8Chunk[sBlob.u8ChunkLen] = sBlob.au8Header[sBlob.u8HeaderPos];
+      sBlob.u8HeaderPos++;
+      sBlob.u8ChunkLen++;
+    }
+    else if (sBlob.u8BitCount >= EEP_BLOB_BYTE_BITS)
+    {
+      sBlob.au8Chunk[sBlob.u8ChunkLen] = (uint8_t)u32EEP24LCXXBlobGetBits(EEP_BLOB_BYTE_BITS);
+      sBlob.u8ChunkLen++;
+    }
+    else if (sBlob.u16Index < sBlob.psBlob->u16DataSize)
+    {
+      vEEP24LCXXBlobEncode();
+    }
+    else
+    {
+      /* pad the last byte */
+      vEEP24LCXXBlobPutBits(EEP_BLOB_ZERO, EEP_BLOB_BYTE_BITS - sBlob.u8BitCount);
+    }
+  }
+
+  sBlob.sData.u16StartAddress = sBlob.u16Address;
+  sBlob.sData.pu8Data         = &sBlob.au8Chunk[0];
+  sBlob.sData.u16DataSize     = sBlob.u8ChunkLen;
+  sBlob.u16Address           += sBlob.u8ChunkLen;
+
+  sBlob.bChunkReady           = false;
+
+  /* an empty chunk means that the stream does not fit in the capacity, the driver reports the end of the write once */
+  if (sBlob.u8ChunkLen > EEP_BLOB_ZERO)
+  {
+    sBlob.bChunkReady = sBlob.psBlob->psEEPObj->pfbEEPWriteData(&sBlob.sData);
+  }
+
+  return (sBlob.u8ChunkLen > EEP_BLOB_ZERO) && (sBlob.psBlob->psEEPObj->pfeEEPGetTransferState() != EEPROM_STATE_WRITE_ABORTED);
+}
+
+
+/** @brief       This function start the read of the next chunk of the stream
+  * @return      true if the read was started, otherwise false
+ **/
+static bool bEEP24LCXXBlobNextRead(void)
+{
+  sBlob.u8ChunkLen            = u8EEP24LCXXBlobChunkSize();
+  sBlob.u8ChunkPos            = EEP_BLOB_ZERO;
+  sBlob.sData.u16StartAddress = sBlob.u16Address;
+  sBlob.sData.pu8Data         = &sBlob.au8Chunk[0];
+  sBlob.sData.u16DataSize     = sBlob.u8ChunkLen;
+  sBlob.u16Address           += sBlob.u8ChunkLen;
+
+  sBlob.bChunkReady           = false;
+
+  /* the read can end inside its start, the driver reports its end once */
+  if (sBlob.u8ChunkLen > EEP_BLOB_ZERO)
+  {
+    sBlob.bChunkReady = sBlob.psBlob->psEEPObj->pfbEEPReadData(&sBlob.sData);
+  }
+
+  return (sBlob.u8ChunkLen > EEP_BLOB_ZERO) && (sBlob.psBlob->psEEPObj->pfeEEPGetTransferState() != EEPROM_STATE_READ_ABORTED);
+}
+
+
+/** @brief       This function end the operation in progress
+  * @param [IN]  bAborted : true if the operation failed
+  * @return      none
+ **/
+static void vEEP24LCXXBlobEnd(bool bAborted)
+{
+  sBlob.psBlob->bAborted = bAborted;
+  sBlob.eState           = EEP_BLOB_IDLE;
+
+  /* a bus error has already been signaled by the driver */
+  if ((bAborted == true) && (sBlob.psBlob->pfvCbkError != NULL_PTR) &&
+      (sBlob.psBlob->psEEPObj->pfeEEPGetTransferState() != EEPROM_STATE_READ_ABORTED) &&
+      (sBlob.psBlob->psEEPObj->pfeEEPGetTransferState() != EEPROM_STATE_WRITE_ABORTED))
+  {
+    sBlob.psBlob->pfvCbkError();
+  }
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+bool bEEP24LCXXBlobWrite(EEP24LCXXBlob_t *psBlob)
+{
+  bool     bDone = false;
+  uint16_t u16Crc;
+  uint16_t u16Index;
+
+  if ((psBlob != NULL_PTR) && (psBlob->psEEPObj != NULL_PTR) && (psBlob->pu8Data != NULL_PTR))
+  {
+    switch (sBlob.eState)
+    {
+      case EEP_BLOB_IDLE:
+      {
+        sBlob.psBlob          = psBlob;
+        sBlob.eState          = EEP_BLOB_WRITE;
+        sBlob.u16Index        = EEP_BLOB_ZERO;
+        sBlob.u16Address      = psBlob->u16Address;
+        sBlob.u32Bits         = EEP_BLOB_ZERO;
+        sBlob.u8BitCount      = EEP_BLOB_ZERO;
+        sBlob.sData.pfvCbkTransmitEnd = NULL_PTR;
+        sBlob.sData.pfvCbkRcv         = NULL_PTR;
+        sBlob.sData.pfvCbkError       = psBlob->pfvCbkError;
+        psBlob->bAborted      = false;
+        psBlob->u16PackedSize = EEP_BLOB_ZERO;
+
+        /* the header is written first, its CRC needs a pass over the data */
+        u16Crc = EEP_BLOB_CRC_INIT;
+
+        for (u16Index = EEP_BLOB_ZERO; u16Index < psBlob->u16DataSize; u16Index++)
+        {
+          u16Crc = u16EEP24LCXXBlobCrc(u16Crc, psBlob->pu8Data[u16Index]);
+        }
+
+        sBlob.u8HeaderPos     = EEP_BLOB_ZERO;
+        sBlob.au8Header[0]    = (uint8_t)EEP_BLOB_MAGIC;
+        sBlob.au8Header[1]    = (uint8_t)(psBlob->u16DataSize >> EEP_BLOB_BYTE_BITS);
+        sBlob.au8Header[2]    = (uint8_t)(psBlob->u16DataSize & EEP_BLOB_BYTE_MSK);
+        sBlob.au8Header[3]    = (uint8_t)(u16Crc >> EEP_BLOB_BYTE_BITS);
+        sBlob.au8Header[4]    = (uint8_t)(u16Crc & EEP_BLOB_BYTE_MSK);
+
+        if ((psBlob->u16DataSize == EEP_BLOB_ZERO) || (psBlob->u16Address > (EEPROM_DATA_SIZE_MAX - 1)) ||
+            (psBlob->u16Capacity > (EEPROM_DATA_SIZE_MAX - psBlob->u16Address)) ||
+            (bEEP24LCXXInitInst(psBlob->psEEPObj) == false) || (bEEP24LCXXBlobNextWrite() == false))
+        {
+          vEEP24LCXXBlobEnd(true);
+          bDone = true;
+        }
+        break;
+      }
+
+      case EEP_BLOB_WRITE:
+      {
+        if (psBlob->psEEPObj->pfeEEPGetTransferState() == EEPROM_STATE_WRITE_ABORTED)
+        {
+          /* checked first because the write restarts from an aborted state */
+          vEEP24LCXXBlobEnd(true);
+          bDone = true;
+        }
+        else if ((sBlob.bChunkReady == false) && (psBlob->psEEPObj->pfbEEPWriteData(&sBlob.sData) == false))
+        {
+          /* we wait until the chunk is written */
+        }
+        else if ((sBlob.u16Index == psBlob->u16DataSize) && (sBlob.u8BitCount == EEP_BLOB_ZERO))
+        {
+          psBlob->u16PackedSize = sBlob.u16Address - psBlob->u16Address;
+          vEEP24LCXXBlobEnd(false);
+          bDone = true;
+        }
+        else if (bEEP24LCXXBlobNextWrite() == false)
+        {
+          vEEP24LCXXBlobEnd(true);
+          bDone = true;
+        }
+        else
+        {
+          /* next chunk started */
+        }
+        break;
+      }
+
+      default:
+        /* a read is in progress */
+        break;
+    }
+  }
+
+  return bDone;
+}
+
+
+bool bEEP24LCXXBlobRead(EEP24LCXXBlob_t *psBlob)
+{
+  bool bDone = false;
+
+  if ((psBlob != NULL_PTR) && (psBlob->psEEPObj != NULL_PTR) && (psBlob->pu8Data != NULL_PTR))
+  {
+    switch (sBlob.eState)
+    {
+      case EEP_BLOB_IDLE:
+      {
+        sBlob.psBlob          = psBlob;
+        sBlob.eState          = EEP_BLOB_READ;
+        sBlob.u16Index        = EEP_BLOB_ZERO;
+        sBlob.u16Address      = psBlob->u16Address;
+        sBlob.u32Bits         = EEP_BLOB_ZERO;
+        sBlob.u8BitCount      = EEP_BLOB_ZERO;
+        sBlob.bHeader         = false;
+        sBlob.u8HeaderPos     = EEP_BLOB_ZERO;
+        sBlob.u16Crc          = EEP_BLOB_CRC_INIT;
+        sBlob.sData.pfvCbkTransmitEnd = NULL_PTR;
+        sBlob.sData.pfvCbkRcv         = NULL_PTR;
+        sBlob.sData.pfvCbkError       = psBlob->pfvCbkError;
+        psBlob->bAborted      = false;
+        psBlob->u16PackedSize = EEP_BLOB_ZERO;
+
+        if ((psBlob->u16Address > (EEPROM_DATA_SIZE_MAX - 1)) || (psBlob->u16Capacity > (EEPROM_DATA_SIZE_MAX - psBlob->u16Address)) ||
+            (bEEP24LCXXInitInst(psBlob->psEEPObj) == false) || (bEEP24LCXXBlobNextRead() == false))
+        {
+          vEEP24LCXXBlobEnd(true);
+          bDone = true;
+        }
+        break;
+      }
+
+      case EEP_BLOB_READ:
+      {
+        switch (psBlob->psEEPObj->pfeEEPGetTransferState())
+        {
+          case EEPROM_STATE_READ_IN_PROGRESS:
+          case EEPROM_STATE_READ_COMPLETED  :
+          {
+            if ((sBlob.bChunkReady == false) && (psBlob->psEEPObj->pfbEEPReadData(&sBlob.sData) == false))
+            {
+              /* we wait until the chunk is received */
+            }
+            else if (bEEP24LCXXBlobDecode() == false)
+            {
+              vEEP24LCXXBlobEnd(true);
+              bDone = true;
+            }
+            else if ((sBlob.bHeader == true) && (sBlob.u16Index == psBlob->u16DataSize))
+            {
+              /* the rest of the chunk is not part of the blob */
+              psBlob->u16PackedSize = (sBlob.u16Address - psBlob->u16Address) - (sBlob.u8ChunkLen - sBlob.u8ChunkPos);
+              vEEP24LCXXBlobEnd(false);
+              bDone = true;
+            }
+            else if (bEEP24LCXXBlobNextRead() == false)
+            {
+              /* the stream ends after the capacity */
+              vEEP24LCXXBlobEnd(true);
+              bDone = true;
+            }
+            else
+            {
+              /* next chunk started */
+            }
+            break;
+          }
+
+          default:
+            /* the read has been aborted */
+            vEEP24LCXXBlobEnd(true);
+            bDone = true;
+            break;
+        }
+        break;
+      }
+
+      default:
+        /* a write is in progress */
+        break;
+    }
+  }
+
+  return bDone;
+}
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                          E N D   OF  M O D U L E                                                 *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,352 @@
+
+/********************************************************************************************************************
+* @file		eep_24LCXX_rtos.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the blocking and thread safe api of the eeprom 24LC32A.
+*
+*********************************************************************************************************************
+*@remarks
+*		The non blocking state machine of eep_24LCXX.c is still used, this layer only decides when the
+*		calling task must sleep : on the completion semaphore during a transfer, with a delay during
+*		the internal write cycle. A read is made of transfers of one page at most, the receive index of the
+*		I2C driver counts 255 bytes only.
+*		The semaphore is taken for EEPROM_RTOS_WAIT_SLICE_MS at most, then the state of the driver is
+*		checked again : a transfer refused or lost by the HAL never blocks the task. An operation which
+*		fails is aborted, and the bus mutex is only released when the transfer still on the bus has
+*		ended, or after EEPROM_RTOS_DRAIN_MS (the driver then refuses to start a transfer until the HAL
+*		signals the end of the previous one).
+*
+********************************************************************************************************************/
+
+
+#include "eep_24LCXX_rtos.h"
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                             D E F I N I T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEPROM_RTOS_WRITE_CYCLE_MS           (uint32_t)(6)        /* 5 ms write cycle + 1 ms, the driver waits strictly more than 5 ms */
+#define EEPROM_RTOS_WAIT_SLICE_MS            (uint32_t)(10)       /* longest wait on the semaphore before the state is checked again */
+#define EEPROM_RTOS_DRAIN_MS                 (uint32_t)(10)       /* longest wait for the end of the transfer of an aborted operation */
+
+#define EEPROM_RTOS_INIT                     {                                        \
+                                               .bInitialized = false,                 \
+                                               .sBusMutex    = NULL_PTR,              \
+                                               .sDoneSem     = NULL_PTR,              \
+                                               .psUserData   = NULL_PTR,              \
+                                               .bError       = false                  \
+                                             }
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** control block of the blocking api */
+struct EEPROMRtos
+{
+  bool                bInitialized;           ///< true when the operating system objects were created
+  EEPOsMutex_t        sBusMutex;              ///< serialize the access to the driver and to the I2C bus
+  EEPOsSem_t          sDoneSem;               ///< given by the driver callbacks at the end of each transfer
+  EEP24LCXXData_t     *psUserData;            ///< request of the task owning the bus, used to forward the callbacks
+  volatile bool       bError;                 ///< set by the error callback
+};
+
+typedef struct EEPROMRtos EEPROMRtos_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                      P R I V A T E  V A R I A B L E                                              *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** blocking api control block variable */
+static EEPROMRtos_t sRtos = EEPROM_RTOS_INIT;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function run a driver operation until it is completed, aborted or timed out
+  * @param [IN]  psEEPObj     : pointer to the eeprom object
+  * @param [IN]  bWrite       : true for a write operation, false for a read operation
+  * @param [IN]  psEEPData    : eeprom data
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation
+  * @return      true if the operation was done correctly, otherwise false
+ **/
+static bool bEEP24LCXXRtosRun(EEP24LCXXObj_t *psEEPObj, bool bWrite, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs);
+
+
+/** @brief       This function compute the remaining time of an operation
+  * @param [IN]  u32StartMs   : start of the operation
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation
+  * @return      remaining time in milliseconds, EEP_OS_WAIT_FOREVER if there is no timeout
+ **/
+static uint32_t u32EEP24LCXXRtosRemaining(uint32_t u32StartMs, uint32_t u32TimeOutMs);
+
+
+/** @brief       This function abort the operation of the driver and wait for the end of the transfer on the bus
+  * @return      none
+ **/
+static void vEEP24LCXXRtosDrain(void);
+
+
+/** @brief       This function is call when a write transfer is completed
+  * @return      none
+ **/
+static void vEEP24LCXXRtosTransmitHandler(void);
+
+
+/** @brief       This function is call when all data have been received
+  * @return      none
+ **/
+static void vEEP24LCXXRtosReceiveHandler(void);
+
+
+/** @brief       This function is call when error occur during transmission
+  * @return      none
+ **/
+static void vEEP24LCXXRtosErrorHandler(void);
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function compute the remaining time of an operation
+  * @param [IN]  u32StartMs   : start of the operation
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation
+  * @return      remaining time in milliseconds, EEP_OS_WAIT_FOREVER if there is no timeout
+ **/
+static uint32_t u32EEP24LCXXRtosRemaining(uint32_t u32StartMs, uint32_t u32TimeOutMs)
+{
+  uint32_t u32Remaining = EEP_OS_WAIT_FOREVER;
+  uint32_t u32Elapsed   = u32EEPOsGetTickMs() - u32StartMs;
+
+  if (u32TimeOutMs != EEP_OS_WAIT_FOREVER)
+  {
+    u32Remaining = (u32Elapsed < u32TimeOutMs) ? (u32TimeOutMs - u32Elapsed) : EEP_OS_NO_WAIT;
+  }
+
+  return u32Remaining;
+}
+
+
+/** @brief       This function abort the operation of the driver and wait for the end of the transfer on the bus
+  * @return      none
+ **/
+static void vEEP24LCXXRtosDrain(void)
+{
+  uint32_t u32StartMs = u32EEPOsGetTickMs();
+
+  /* the callbacks of the transfer give the semaphore, they no more find an operation to go on */
+  while ((bEEP24LCXXAbort() == false) && ((u32EEPOsGetTickMs() - u32StartMs) < EEPROM_RTOS_DRAIN_MS))
+  {
+    (void)bEEPOsSemTake(sRtos.sDoneSem, EEPROM_RTOS_DRAIN_MS);
+  }
+}
+
+
+/** @brief       This function run a driver operation until it is completed, aborted or timed out
+  * @param [IN]  psEEPObj     : pointer to the eeprom object
+  * @param [IN]  bWrite       : true for a write operation, false for a read operation
+  * @param [IN]  psEEPData    : eeprom data
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation
+  * @return      true if the operation was done correctly, otherwise false
+ **/
+static bool bEEP24LCXXRtosRun(EEP24LCXXObj_t *psEEPObj, bool bWrite, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs)
+{
+  bool            bRet       = false;
+  bool            bAbort     = false;
+  uint32_t        u32StartMs = u32EEPOsGetTickMs();
+  uint32_t        u32Remaining;
+  uint16_t        u16Left;
+  EEP24LCXXData_t sData;
+
+  if ((sRtos.bInitialized == true) && (psEEPObj != NULL_PTR) && (psEEPData != NULL_PTR) && (psEEPData->u16DataSize <= EEPROM_DATA_SIZE_MAX))
+  {
+    if (bEEPOsMutexTake(sRtos.sBusMutex, u32TimeOutMs) == true)
+    {
+      /* the bus is ours until the mutex is released, bind the driver to this eeprom */
+      if (bEEP24LCXXInitInst(psEEPObj) == true)
+      {
+        /* the driver callbacks wake up the task, the user callbacks are forwarded */
+        sData                   = *psEEPData;
+        sData.pfvCbkTransmitEnd = vEEP24LCXXRtosTransmitHandler;
+        sData.pfvCbkRcv         = vEEP24LCXXRtosReceiveHandler;
+        sData.pfvCbkError       = vEEP24LCXXRtosErrorHandler;
+        sRtos.psUserData        = psEEPData;
+        sRtos.bError            = false;
+        u16Left                 = psEEPData->u16DataSize;
+
+        /* the receive index of the I2C driver counts 255 bytes only, a read is made of transfers of one page */
+        if ((bWrite == false) && (u16Left > EEPROM_PAGE_SIZE))
+        {
+          sData.u16DataSize = EEPROM_PAGE_SIZE;
+        }
+
+        /* drop a completion left by a previous operation which has timed out */
+        (void)bEEPOsSemTake(sRtos.sDoneSem, EEP_OS_NO_WAIT);
+
+        while ((bRet == false) && (bAbort == false))
+        {
+          if (bWrite == true)
+          {
+            bRet = psEEPObj->pfbEEPWriteData(&sData);
+          }
+          else
+          {
+            bRet = psEEPObj->pfbEEPReadData(&sData);
+
+            /* the next page continues from the address pointer of the eeprom, without address phase */
+            if ((bRet == true) && (sData.u16DataSize < u16Left))
+            {
+              u16Left               -= sData.u16DataSize;
+              sData.u16StartAddress += sData.u16DataSize;
+              sData.pu8Data         += sData.u16DataSize;
+              sData.u16DataSize      = (u16Left > EEPROM_PAGE_SIZE) ? EEPROM_PAGE_SIZE : u16Left;
+              bRet                   = false;
+            }
+          }
+
+          u32Remaining = u32EEP24LCXXRtosRemaining(u32StartMs, u32TimeOutMs);
+
+          if ((bRet == false) && (u32Remaining == EEP_OS_NO_WAIT))
+          {
+            bAbort = true;
+          }
+          else if (bRet == false)
+          {
+            switch (psEEPObj->pfeEEPGetTransferState())
+            {
+              case EEPROM_STATE_READ_IN_PROGRESS     :
+              case EEPROM_STATE_TRANSFER_IN_PROGRESS :
+                /* sleep until the I2C interrupt signals the end of the transfer, the state is checked again after a slice */
+                (void)bEEPOsSemTake(sRtos.sDoneSem, (u32Remaining < EEPROM_RTOS_WAIT_SLICE_MS) ? u32Remaining : EEPROM_RTOS_WAIT_SLICE_MS);
+                bAbort = sRtos.bError;
+                break;
+
+              case EEPROM_STATE_WAIT_WRITE_CYCLE :
+                /* the chip does not answer during its internal write cycle */
+                vEEPOsDelayMs(EEPROM_RTOS_WRITE_CYCLE_MS);
+                break;
+
+              case EEPROM_STATE_READ_ABORTED  :
+              case EEPROM_STATE_WRITE_ABORTED :
+                bAbort = true;
+                break;
+
+              default:
+                /* the next state is reached by the next call */
+                break;
+            }
+          }
+          else
+          {
+            /* operation completed */
+          }
+        }
+
+        /* the bus is given back without transfer of this operation on it */
+        if (bRet == false)
+        {
+          vEEP24LCXXRtosDrain();
+        }
+
+        sRtos.psUserData = NULL_PTR;
+      }
+
+      vEEPOsMutexGive(sRtos.sBusMutex);
+    }
+  }
+
+  return bRet;
+}
+
+
+/** @brief       This function is call when a write transfer is completed
+  * @return      none
+ **/
+static void vEEP24LCXXRtosTransmitHandler(void)
+{
+  if ((sRtos.psUserData != NULL_PTR) && (sRtos.psUserData->pfvCbkTransmitEnd != NULL_PTR))
+  {
+    sRtos.psUserData->pfvCbkTransmitEnd();
+  }
+
+  vEEPOsSemGiveFromIsr(sRtos.sDoneSem);
+}
+
+
+/** @brief       This function is call when all data have been received
+  * @return      none
+ **/
+static void vEEP24LCXXRtosReceiveHandler(void)
+{
+  if ((sRtos.psUserData != NULL_PTR) && (sRtos.psUserData->pfvCbkRcv != NULL_PTR))
+  {
+    sRtos.psUserData->pfvCbkRcv();
+  }
+
+  vEEPOsSemGiveFromIsr(sRtos.sDoneSem);
+}
+
+
+/** @brief       This function is call when error occur during transmission
+  * @return      none
+ **/
+static void vEEP24LCXXRtosErrorHandler(void)
+{
+  sRtos.bError = true;
+
+  if ((sRtos.psUserData != NULL_PTR) && (sRtos.psUserData->pfvCbkError != NULL_PTR))
+  {
+    sRtos.psUserData->pfvCbkError();
+  }
+
+  vEEPOsSemGiveFromIsr(sRtos.sDoneSem);
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+bool bEEP24LCXXRtosInit(void)
+{
+  if (sRtos.bInitialized == false)
+  {
+    sRtos.bInitialized = (bEEPOsMutexCreate(&sRtos.sBusMutex) == true) && (bEEPOsSemCreate(&sRtos.sDoneSem) == true);
+  }
+
+  return sRtos.bInitialized;
+}
+
+
+bool bEEP24LCXXWriteBlocking(EEP24LCXXObj_t *psEEPObj, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs)
+{
+  return bEEP24LCXXRtosRun(psEEPObj, true, psEEPData, u32TimeOutMs);
+}
+
+
+bool bEEP24LCXXReadBlocking(EEP24LCXXObj_t *psEEPObj, EEP24LCXXData_t *psEEPData, uint32_t u32TimeOutMs)
+{
+  return bEEP24LCXXRtosRun(psEEPObj, false, psEEPData, u32TimeOutMs);
+}
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                          E N D   OF  M O D U L E                                                 *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
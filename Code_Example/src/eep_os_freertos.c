@@ -0,0 +1,151 @@
+
+/********************************************************************************************************************
+* @file		eep_os_freertos.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the FreeRTOS port of the eeprom operating system abstraction.
+*
+*********************************************************************************************************************
+*@remarks
+*		Only compiled when EEP_OS_PORT_FREERTOS is defined.
+*		The semaphore is given from the interrupt or from a task, told apart by xPortIsInsideInterrupt(). It
+*		is provided by the Cortex-M ports of FreeRTOS V10.4 and later (ARM_CM0, ARM_CM3, ARM_CM4F, ARM_CM7,
+*		ARM_CM23 of the R7FA2E1A9, ARM_CM33). With another port, EEP_OS_IN_ISR() must be defined at build
+*		time with the check of this port.
+*
+********************************************************************************************************************/
+
+
+#include "eep_os_port.h"
+
+#if defined(EEP_OS_PORT_FREERTOS)
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                             D E F I N I T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_OS_MS_PER_SECOND                 (uint64_t)(1000)
+
+#if !defined(EEP_OS_IN_ISR)
+#define EEP_OS_IN_ISR()                      (xPortIsInsideInterrupt() == pdTRUE)
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function convert milliseconds in ticks, the result is rounded up
+  * @param [IN]  u32TimeMs : time in milliseconds
+  * @return      number of ticks
+ **/
+static TickType_t xEEPOsMsToTicks(uint32_t u32TimeMs);
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function convert milliseconds in ticks, the result is rounded up
+  * @param [IN]  u32TimeMs : time in milliseconds
+  * @return      number of ticks
+ **/
+static TickType_t xEEPOsMsToTicks(uint32_t u32TimeMs)
+{
+  TickType_t xTicks = portMAX_DELAY;
+
+  if (u32TimeMs != EEP_OS_WAIT_FOREVER)
+  {
+    /* pdMS_TO_TICKS round down, a 5 ms wait would become 0 tick with a 100 Hz tick */
+    xTicks = (TickType_t)((((uint64_t)u32TimeMs * configTICK_RATE_HZ) + (EEP_OS_MS_PER_SECOND - 1)) / EEP_OS_MS_PER_SECOND);
+  }
+
+  return xTicks;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+bool bEEPOsMutexCreate(EEPOsMutex_t *psMutex)
+{
+  *psMutex = (EEPOsMutex_t)xSemaphoreCreateMutex();
+
+  return (*psMutex != NULL);
+}
+
+
+bool bEEPOsMutexTake(EEPOsMutex_t sMutex, uint32_t u32TimeOutMs)
+{
+  return (pdTRUE == xSemaphoreTake((SemaphoreHandle_t)sMutex, xEEPOsMsToTicks(u32TimeOutMs)));
+}
+
+
+void vEEPOsMutexGive(EEPOsMutex_t sMutex)
+{
+  (void)xSemaphoreGive((SemaphoreHandle_t)sMutex);
+}
+
+
+bool bEEPOsSemCreate(EEPOsSem_t *psSem)
+{
+  *psSem = (EEPOsSem_t)xSemaphoreCreateBinary();
+
+  return (*psSem != NULL);
+}
+
+
+bool bEEPOsSemTake(EEPOsSem_t sSem, uint32_t u32TimeOutMs)
+{
+  return (pdTRUE == xSemaphoreTake((SemaphoreHandle_t)sSem, xEEPOsMsToTicks(u32TimeOutMs)));
+}
+
+
+void vEEPOsSemGiveFromIsr(EEPOsSem_t sSem)
+{
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+  /* the driver callbacks are normally called by the I2C interrupt, but can also come from a task */
+  if (EEP_OS_IN_ISR())
+  {
+    (void)xSemaphoreGiveFromISR((SemaphoreHandle_t)sSem, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+  }
+  else
+  {
+    (void)xSemaphoreGive((SemaphoreHandle_t)sSem);
+  }
+}
+
+
+void vEEPOsDelayMs(uint32_t u32DelayMs)
+{
+  vTaskDelay(xEEPOsMsToTicks(u32DelayMs));
+}
+
+
+uint32_t u32EEPOsGetTickMs(void)
+{
+  /* portTICK_PERIOD_MS is 0 with a tick faster than 1 kHz, and not exact when the rate does not divide 1000 */
+  return (uint32_t)(((uint64_t)xTaskGetTickCount() * EEP_OS_MS_PER_SECOND) / configTICK_RATE_HZ);
+}
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                          E N D   OF  M O D U L E                                                 *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
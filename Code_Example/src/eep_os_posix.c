@@ -0,0 +1,243 @@
+
+/********************************************************************************************************************
+* @file		eep_os_posix.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the POSIX port of the eeprom operating system abstraction.
+*
+*********************************************************************************************************************
+*@remarks
+*		Only compiled when EEP_OS_PORT_POSIX is defined. It is used to run the blocking api on a host with
+*		the simulator of the tests, which only advances inside vEEPSimStep() (called by __WFI()) : the
+*		"interrupt" callbacks run in the start call of a transfer (immediate mode), in the test which steps
+*		the simulator, or in the interrupt thread of the simulator when it is built with EEP_SIM_THREAD.
+*
+********************************************************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "eep_os_port.h"
+
+#if defined(EEP_OS_PORT_POSIX)
+
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                             D E F I N I T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_OS_MS_PER_SECOND                 (uint32_t)(1000)
+#define EEP_OS_NS_PER_MS                     (long)(1000000)
+#define EEP_OS_NS_PER_SECOND                 (long)(1000000000)
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** binary semaphore, pthread has no binary semaphore so it is built with a condition */
+struct EEPOsPosixSem
+{
+  pthread_mutex_t sLock;                ///< protect bGiven
+  pthread_cond_t  sCond;                ///< signaled when the semaphore is given
+  bool            bGiven;               ///< state of the semaphore
+};
+
+typedef struct EEPOsPosixSem EEPOsPosixSem_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                          P R I V A T E  F U N C T I O N   D E C L A R A T I O N                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function compute an absolute deadline from now
+  * @param [IN]  eClock    : clock used for the deadline
+  * @param [IN]  u32TimeMs : relative time in milliseconds
+  * @param [OUT] psDeadline : absolute deadline
+  * @return      none
+ **/
+static void vEEPOsDeadline(clockid_t eClock, uint32_t u32TimeMs, struct timespec *psDeadline);
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                           P R I V A T E  F U N C T I O N  D E F I N I T I O N                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function compute an absolute deadline from now
+  * @param [IN]  eClock    : clock used for the deadline
+  * @param [IN]  u32TimeMs : relative time in milliseconds
+  * @param [OUT] psDeadline : absolute deadline
+  * @return      none
+ **/
+static void vEEPOsDeadline(clockid_t eClock, uint32_t u32TimeMs, struct timespec *psDeadline)
+{
+  (void)clock_gettime(eClock, psDeadline);
+
+  psDeadline->tv_sec  += (time_t)(u32TimeMs / EEP_OS_MS_PER_SECOND);
+  psDeadline->tv_nsec += (long)(u32TimeMs % EEP_OS_MS_PER_SECOND) * EEP_OS_NS_PER_MS;
+
+  if (psDeadline->tv_nsec >= EEP_OS_NS_PER_SECOND)
+  {
+    psDeadline->tv_sec  += 1;
+    psDeadline->tv_nsec -= EEP_OS_NS_PER_SECOND;
+  }
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+
+bool bEEPOsMutexCreate(EEPOsMutex_t *psMutex)
+{
+  pthread_mutex_t *psLock = malloc(sizeof(pthread_mutex_t));
+
+  if ((psLock != NULL) && (pthread_mutex_init(psLock, NULL) != 0))
+  {
+    free(psLock);
+    psLock = NULL;
+  }
+
+  *psMutex = (EEPOsMutex_t)psLock;
+
+  return (*psMutex != NULL);
+}
+
+
+bool bEEPOsMutexTake(EEPOsMutex_t sMutex, uint32_t u32TimeOutMs)
+{
+  struct timespec sDeadline;
+  int iRet;
+
+  if (u32TimeOutMs == EEP_OS_WAIT_FOREVER)
+  {
+    iRet = pthread_mutex_lock((pthread_mutex_t *)sMutex);
+  }
+  else
+  {
+    /* pthread_mutex_timedlock only accept CLOCK_REALTIME */
+    vEEPOsDeadline(CLOCK_REALTIME, u32TimeOutMs, &sDeadline);
+    iRet = pthread_mutex_timedlock((pthread_mutex_t *)sMutex, &sDeadline);
+  }
+
+  return (iRet == 0);
+}
+
+
+void vEEPOsMutexGive(EEPOsMutex_t sMutex)
+{
+  (void)pthread_mutex_unlock((pthread_mutex_t *)sMutex);
+}
+
+
+bool bEEPOsSemCreate(EEPOsSem_t *psSem)
+{
+  pthread_condattr_t sAttr;
+  EEPOsPosixSem_t    *psPosixSem = malloc(sizeof(EEPOsPosixSem_t));
+
+  if (psPosixSem != NULL)
+  {
+    psPosixSem->bGiven = false;
+
+    (void)pthread_condattr_init(&sAttr);
+    (void)pthread_condattr_setclock(&sAttr, CLOCK_MONOTONIC);
+
+    if ((pthread_mutex_init(&psPosixSem->sLock, NULL) != 0) || (pthread_cond_init(&psPosixSem->sCond, &sAttr) != 0))
+    {
+      free(psPosixSem);
+      psPosixSem = NULL;
+    }
+
+    (void)pthread_condattr_destroy(&sAttr);
+  }
+
+  *psSem = (EEPOsSem_t)psPosixSem;
+
+  return (*psSem != NULL);
+}
+
+
+bool bEEPOsSemTake(EEPOsSem_t sSem, uint32_t u32TimeOutMs)
+{
+  EEPOsPosixSem_t *psPosixSem = (EEPOsPosixSem_t *)sSem;
+  struct timespec sDeadline;
+  int             iRet        = 0;
+  bool            bRet;
+
+  vEEPOsDeadline(CLOCK_MONOTONIC, u32TimeOutMs, &sDeadline);
+
+  (void)pthread_mutex_lock(&psPosixSem->sLock);
+
+  while ((psPosixSem->bGiven == false) && (iRet != ETIMEDOUT) && (u32TimeOutMs != EEP_OS_NO_WAIT))
+  {
+    if (u32TimeOutMs == EEP_OS_WAIT_FOREVER)
+    {
+      iRet = pthread_cond_wait(&psPosixSem->sCond, &psPosixSem->sLock);
+    }
+    else
+    {
+      iRet = pthread_cond_timedwait(&psPosixSem->sCond, &psPosixSem->sLock, &sDeadline);
+    }
+  }
+
+  bRet               = psPosixSem->bGiven;
+  psPosixSem->bGiven = false;
+
+  (void)pthread_mutex_unlock(&psPosixSem->sLock);
+
+  return bRet;
+}
+
+
+void vEEPOsSemGiveFromIsr(EEPOsSem_t sSem)
+{
+  EEPOsPosixSem_t *psPosixSem = (EEPOsPosixSem_t *)sSem;
+
+  (void)pthread_mutex_lock(&psPosixSem->sLock);
+  psPosixSem->bGiven = true;
+  (void)pthread_cond_signal(&psPosixSem->sCond);
+  (void)pthread_mutex_unlock(&psPosixSem->sLock);
+}
+
+
+void vEEPOsDelayMs(uint32_t u32DelayMs)
+{
+  struct timespec sDelay;
+
+  sDelay.tv_sec  = (time_t)(u32DelayMs / EEP_OS_MS_PER_SECOND);
+  sDelay.tv_nsec = (long)(u32DelayMs % EEP_OS_MS_PER_SECOND) * EEP_OS_NS_PER_MS;
+
+  /* restart the sleep with the remaining time if a signal interrupt it */
+  while ((nanosleep(&sDelay, &sDelay) != 0) && (errno == EINTR))
+  {
+  }
+}
+
+
+uint32_t u32EEPOsGetTickMs(void)
+{
+  struct timespec sNow;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &sNow);
+
+  return (uint32_t)(((uint64_t)sNow.tv_sec * EEP_OS_MS_PER_SECOND) + (uint64_t)(sNow.tv_nsec / EEP_OS_NS_PER_MS));
+}
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                          E N D   OF  M O D U L E                                                 *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
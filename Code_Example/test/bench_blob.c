@@ -0,0 +1,282 @@
+/********************************************************************************************************************
+* @file		bench_blob.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the benchmark of the compressed blob api on the host simulator.
+*
+*********************************************************************************************************************
+* @remarks
+*		For each kind of data the blob is written and read back, then the compression ratio, the duration
+*		of the write on the simulated bus (against the same data written without compression) and the
+*		host throughput of the compression and of the decompression are printed. The host time includes
+*		the simulated transfers, which end inside their start call.
+*		The update of a blob whose write was cut after one of its pages must not be read back.
+*		The RAM of the api is the bss of its object, printed by the bench target of the Makefile.
+*
+********************************************************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "R7FA2E1A9.h"
+#include "eep_24LCXX_blob.h"
+#include "eep_sim.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define BLOB_DATA_SIZE                    (uint16_t)(1024)
+#define BLOB_CAPACITY                     EEP_BLOB_PACKED_SIZE_MAX(BLOB_DATA_SIZE)
+#define BLOB_ADDRESS                      (uint16_t)(0x0000)
+#define BLOB_SPARE_ADDRESS                (uint16_t)(0x0800)
+#define BLOB_KIND_COUNT                   (uint8_t)(4)
+#define BLOB_REPEAT                       (uint32_t)(20)
+#define BLOB_CUT_OFFSET                   (uint16_t)(100)
+#define BLOB_CUT_PATTERN                  (uint8_t)(0x55)
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+static EEP24LCXXObj_t   sEEP;
+static uint8_t          au8Data[BLOB_DATA_SIZE];
+static uint8_t          au8ReadBack[BLOB_DATA_SIZE];
+static uint32_t         u32Failures;
+
+static const char * const apcKind[BLOB_KIND_COUNT] = { "config", "samples", "zeros", "random" };
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function read the host clock
+  * @return      time in nanoseconds
+ **/
+static uint64_t u64BlobNs(void)
+{
+  struct timespec sNow;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &sNow);
+
+  return ((uint64_t)sNow.tv_sec * 1000000000u) + (uint64_t)sNow.tv_nsec;
+}
+
+
+/** @brief       This function fill the data of a kind
+  * @param [IN]  u8Kind : kind of data
+  * @return      none
+ **/
+static void vBlobFill(uint8_t u8Kind)
+{
+  static const char acLine[] = "name=sensor%u;gain=1.000;offset=0;unit=mV;enabled=1\n";
+  uint16_t          u16Index;
+
+  for (u16Index = 0; u16Index < BLOB_DATA_SIZE; u16Index++)
+  {
+    switch (u8Kind)
+    {
+      case 0  : au8Data[u16Index] = (uint8_t)acLine[u16Index % (sizeof(acLine) - 1u)] + (uint8_t)((u16Index / (sizeof(acLine) - 1u)) % 3u); break;
+      case 1  : au8Data[u16Index] = (uint8_t)(((u16Index & 1u) == 0u) ? 0x01u : (uint8_t)(0x80u + ((u16Index / 16u) % 4u))); break;
+      case 2  : au8Data[u16Index] = 0u; break;
+      default : au8Data[u16Index] = (uint8_t)u32EEPSimRandom(); break;
+    }
+  }
+}
+
+
+/** @brief       This function write a blob until the end of the operation
+  * @param [IN]  psBlob : blob description
+  * @return      none
+ **/
+static void vBlobWrite(EEP24LCXXBlob_t *psBlob)
+{
+  while (bEEP24LCXXBlobWrite(psBlob) == false)
+  {
+    __WFI();
+  }
+}
+
+
+/** @brief       This function read a blob until the end of the operation
+  * @param [IN]  psBlob : blob description
+  * @return      none
+ **/
+static void vBlobRead(EEP24LCXXBlob_t *psBlob)
+{
+  while (bEEP24LCXXBlobRead(psBlob) == false)
+  {
+    __WFI();
+  }
+}
+
+
+/** @brief       This function prepare a blob description
+  * @param [OUT] psBlob     : blob description
+  * @param [IN]  u16Address : address of the blob
+  * @param [IN]  pu8Data    : data to write or buffer of the read
+  * @return      none
+ **/
+static void vBlobSet(EEP24LCXXBlob_t *psBlob, uint16_t u16Address, uint8_t *pu8Data)
+{
+  memset(psBlob, 0, sizeof(*psBlob));
+  psBlob->psEEPObj    = &sEEP;
+  psBlob->u16Address  = u16Address;
+  psBlob->u16Capacity = BLOB_CAPACITY;
+  psBlob->pu8Data     = pu8Data;
+  psBlob->u16DataSize = BLOB_DATA_SIZE;
+}
+
+
+/** @brief       This function measure a kind of data
+  * @param [IN]  u8Kind : kind of data
+  * @return      none
+ **/
+static void vBlobKind(uint8_t u8Kind)
+{
+  EEP24LCXXBlob_t  sBlob;
+  EEP24LCXXData_t  sRaw;
+  uint64_t         u64StartUs;
+  uint64_t         u64BlobUs;
+  uint64_t         u64RawUs;
+  uint64_t         u64WriteNs = 0u;
+  uint64_t         u64ReadNs  = 0u;
+  uint64_t         u64StartNs;
+  uint32_t         u32Repeat;
+
+  vBlobFill(u8Kind);
+
+  /* duration on the bus, the write cycle signaled by the one-shot timer */
+  vEEPSimSetImmediate(false);
+  vBlobSet(&sBlob, BLOB_ADDRESS, au8Data);
+  u64StartUs = u64EEPSimTimeUs();
+  vBlobWrite(&sBlob);
+  u64BlobUs  = u64EEPSimTimeUs() - u64StartUs;
+
+  memset(&sRaw, 0, sizeof(sRaw));
+  sRaw.u16StartAddress = BLOB_SPARE_ADDRESS;
+  sRaw.pu8Data         = au8Data;
+  sRaw.u16DataSize     = BLOB_DATA_SIZE;
+  u64StartUs = u64EEPSimTimeUs();
+
+  while (sEEP.pfbEEPWriteData(&sRaw) == false)
+  {
+    __WFI();
+  }
+
+  u64RawUs = u64EEPSimTimeUs() - u64StartUs;
+
+  /* host throughput */
+  vEEPSimSetImmediate(true);
+
+  for (u32Repeat = 0; u32Repeat < BLOB_REPEAT; u32Repeat++)
+  {
+    vBlobSet(&sBlob, BLOB_ADDRESS, au8Data);
+    u64StartNs  = u64BlobNs();
+    vBlobWrite(&sBlob);
+    u64WriteNs += u64BlobNs() - u64StartNs;
+
+    vBlobSet(&sBlob, BLOB_ADDRESS, au8ReadBack);
+    memset(au8ReadBack, 0, sizeof(au8ReadBack));
+    u64StartNs  = u64BlobNs();
+    vBlobRead(&sBlob);
+    u64ReadNs  += u64BlobNs() - u64StartNs;
+  }
+
+  if ((sBlob.bAborted == true) || (sBlob.u16DataSize != BLOB_DATA_SIZE) || (memcmp(au8ReadBack, au8Data, BLOB_DATA_SIZE) != 0))
+  {
+    u32Failures++;
+    printf("FAIL : %s is not read back\n", apcKind[u8Kind]);
+  }
+
+  printf("%-8s %5u -> %5u bytes  ratio %5.1f%%  bus %7.1f ms (raw %7.1f ms)  compress %6.2f MB/s  decompress %6.2f MB/s\n",
+         apcKind[u8Kind], (unsigned)BLOB_DATA_SIZE, (unsigned)sBlob.u16PackedSize, (sBlob.u16PackedSize * 100.0) / BLOB_DATA_SIZE,
+         u64BlobUs / 1000.0, u64RawUs / 1000.0,
+         (u64WriteNs > 0u) ? ((double)BLOB_DATA_SIZE * BLOB_REPEAT * 1e3 / u64WriteNs) : 0.0,
+         (u64ReadNs > 0u) ? ((double)BLOB_DATA_SIZE * BLOB_REPEAT * 1e3 / u64ReadNs) : 0.0);
+}
+
+
+/** @brief       This function check that the update of a blob whose write was cut after one of its pages is not read back
+  * @return      none
+ **/
+static void vBlobCut(void)
+{
+  EEP24LCXXBlob_t  sBlob;
+  uint16_t         u16Cut;
+
+  /* a blob, then its update, one value changed near the end, written elsewhere */
+  vBlobFill(0);
+  vBlobSet(&sBlob, BLOB_ADDRESS, au8Data);
+  vBlobWrite(&sBlob);
+
+  au8Data[BLOB_DATA_SIZE - BLOB_CUT_OFFSET] ^= BLOB_CUT_PATTERN;
+  vBlobSet(&sBlob, BLOB_SPARE_ADDRESS, au8Data);
+  vBlobWrite(&sBlob);
+
+  /* the write of the update over the blob is cut after each of its pages */
+  for (u16Cut = EEPROM_PAGE_SIZE; u16Cut < sBlob.u16PackedSize; u16Cut += EEPROM_PAGE_SIZE)
+  {
+    memcpy(&au8EEPSimMem[0][BLOB_ADDRESS], &au8EEPSimMem[0][BLOB_SPARE_ADDRESS], u16Cut);
+    vBlobSet(&sBlob, BLOB_ADDRESS, au8ReadBack);
+    vBlobRead(&sBlob);
+
+    if (sBlob.bAborted == false)
+    {
+      u32Failures++;
+      printf("FAIL : a blob cut after %u bytes is read back\n", (unsigned)u16Cut);
+    }
+  }
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+int main(void)
+{
+  uint8_t u8Kind;
+
+  vEEPSimReset(0x3500u, 0u);
+  memset(&sEEP, 0, sizeof(sEEP));
+  sEEP.eEEPSlaveAddress = EEP24LCXX_ADDR0;
+  sEEP.psI2CInst        = &sEEPSimI2C;
+  sEEP.psTimerInst      = &sEEPSimTimer;
+  sEEP.pfbStartOneShot  = bEEPSimStartOneShot;
+
+  if (bEEP24LCXXInitInst(&sEEP) == false)
+  {
+    printf("FAIL : init\n");
+    return 1;
+  }
+
+  printf("blob structure of the user : %u bytes\n", (unsigned)sizeof(EEP24LCXXBlob_t));
+
+  for (u8Kind = 0; u8Kind < BLOB_KIND_COUNT; u8Kind++)
+  {
+    vBlobKind(u8Kind);
+  }
+
+  vBlobCut();
+
+  printf("%s : %u failure(s)\n", (u32Failures == 0u) ? "PASS" : "FAIL", (unsigned)u32Failures);
+
+  return (u32Failures == 0u) ? 0 : 1;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
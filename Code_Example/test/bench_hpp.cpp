@@ -0,0 +1,245 @@
+/********************************************************************************************************************
+* @file		bench_hpp.cpp
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the benchmark of the C++ front-end against the C driver on the host simulator.
+*
+*********************************************************************************************************************
+* @remarks
+*		The transfers end inside their start call, so the time measured is the time of the driver code and
+*		of the simulated HAL, which is the same for all paths. The write cycle is waited by stepping the
+*		simulator. The code size of both paths is printed by the bench target of the Makefile.
+*		The C++ front-end runs on the bus objects of the C driver (function pointers) and on the functions
+*		of the HAL (direct calls). The benchmark is linked with link time optimization, so the direct calls
+*		can be inlined across the units like in a firmware built with it.
+*		The pages are read out of order : each read of the C driver and of the front-end has an address phase.
+*		The time is given in host nanoseconds and, on x86, in time stamp counter cycles.
+*
+********************************************************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "eep_24LCXX.hpp"
+
+extern "C"
+{
+#include "eep_sim.h"
+}
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define BENCH_PAGES                       (uint32_t)(2000)
+#define BENCH_PAGE_SIZE                   (uint16_t)(32)
+#define BENCH_AREA                        (uint32_t)(4096)
+#define BENCH_READ_STRIDE                 (uint32_t)(3)        /* pages between two reads, never the next one */
+
+using ObjBus_t  = eep24lcxx::I2CObjBus<&sEEPSimI2C, &sEEPSimTimer>;
+using FuncBus_t = eep24lcxx::I2CFuncBus<bEEPSimStartTransmit, eEEPSimGetTransferState, u32EEPSimGetTickMs, vEEP24LCXXForgetPointer>;
+using EepObj_t  = eep24lcxx::EEP24LCXX<eep24lcxx::Model24LC32A, ObjBus_t, EEP24LCXX_ADDR0>;
+using EepFunc_t = eep24lcxx::EEP24LCXX<eep24lcxx::Model24LC32A, FuncBus_t, EEP24LCXX_ADDR0>;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * time of a run
+ */
+struct BenchTime
+{
+  uint64_t  u64Ns;
+  uint64_t  u64Cycles;
+};
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+static EEP24LCXXObj_t   sEEP;
+static uint8_t          au8Data[BENCH_PAGE_SIZE];
+static uint8_t          au8Area[BENCH_AREA];
+static uint32_t         u32Failures;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function read the time stamp counter
+  * @return      cycles, 0 when the host has no time stamp counter
+ **/
+static uint64_t u64BenchCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0U;
+#endif
+}
+
+
+/** @brief       This function run an operation on all the pages and measure it
+  * @param [IN]  pfbPage    : operation on a page, called until it return true
+  * @param [IN]  u32Stride  : pages between two operations
+  * @return      time of the run
+ **/
+template <typename Page>
+static BenchTime sBenchRun(Page pfbPage, uint32_t u32Stride)
+{
+  BenchTime sTime;
+  uint32_t  u32Page;
+  uint64_t  u64Cycles = u64BenchCycles();
+  auto      sStart    = std::chrono::steady_clock::now();
+
+  for (u32Page = 0U; u32Page < BENCH_PAGES; u32Page++)
+  {
+    const uint32_t u32Address = (u32Page * u32Stride * BENCH_PAGE_SIZE) % BENCH_AREA;
+
+    while (pfbPage(u32Address) == false)
+    {
+      vEEPSimStep();
+    }
+  }
+
+  sTime.u64Cycles = u64BenchCycles() - u64Cycles;
+  sTime.u64Ns     = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sStart).count());
+
+  return sTime;
+}
+
+
+/** @brief       This function print the time of a run
+  * @param [IN]  pcWhat : name of the run
+  * @param [IN]  sTime  : time of the run
+  * @return      none
+ **/
+static void vBenchPrint(const char *pcWhat, BenchTime sTime)
+{
+  std::printf("%-18s %8.1f ns/page  %8.1f cycles/page\n", pcWhat,
+              static_cast<double>(sTime.u64Ns) / BENCH_PAGES, static_cast<double>(sTime.u64Cycles) / BENCH_PAGES);
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+int main(void)
+{
+  EEP24LCXXData_t sData;
+  EEPSimFaults_t  sFaults = {};
+
+  vEEPSimReset(0x2800U, 0U);
+  vEEPSimSetImmediate(true);
+  std::memset(&sEEP, 0, sizeof(sEEP));
+  std::memset(&sData, 0, sizeof(sData));
+
+  for (uint16_t u16Index = 0U; u16Index < BENCH_PAGE_SIZE; u16Index++)
+  {
+    au8Data[u16Index] = static_cast<uint8_t>(u16Index * 7U);
+  }
+
+  sEEP.eEEPSlaveAddress = EEP24LCXX_ADDR0;
+  sEEP.psI2CInst        = &sEEPSimI2C;
+  sEEP.psTimerInst      = &sEEPSimTimer;
+
+  if (bEEP24LCXXInitInst(&sEEP) == false)
+  {
+    std::printf("FAIL : init\n");
+    return 1;
+  }
+
+  sData.pu8Data     = au8Data;
+  sData.u16DataSize = BENCH_PAGE_SIZE;
+
+  vBenchPrint("C   write", sBenchRun([&sData](uint32_t u32Address) { sData.u16StartAddress = static_cast<uint16_t>(u32Address); return sEEP.pfbEEPWriteData(&sData); }, 1U));
+  vBenchPrint("C++ write obj bus", sBenchRun([](uint32_t u32Address) { return EepObj_t::bWrite(u32Address, au8Data, BENCH_PAGE_SIZE); }, 1U));
+  vBenchPrint("C++ write hal bus", sBenchRun([](uint32_t u32Address) { return EepFunc_t::bWrite(u32Address, au8Data, BENCH_PAGE_SIZE); }, 1U));
+
+  /* the same kind of read on each side : random reads, the C driver never continues from the address pointer */
+  sEEPSimStats.u32CurrentRead = 0U;
+  vBenchPrint("C   read", sBenchRun([&sData](uint32_t u32Address) { sData.u16StartAddress = static_cast<uint16_t>(u32Address); return sEEP.pfbEEPReadData(&sData); }, BENCH_READ_STRIDE));
+  vBenchPrint("C++ read obj bus", sBenchRun([](uint32_t u32Address) { return EepObj_t::bRead(u32Address, au8Data, BENCH_PAGE_SIZE); }, BENCH_READ_STRIDE));
+  vBenchPrint("C++ read hal bus", sBenchRun([](uint32_t u32Address) { return EepFunc_t::bRead(u32Address, au8Data, BENCH_PAGE_SIZE); }, BENCH_READ_STRIDE));
+
+  if (sEEPSimStats.u32CurrentRead != 0U)
+  {
+    u32Failures++;
+    std::printf("FAIL : %u reads without address phase\n", static_cast<unsigned>(sEEPSimStats.u32CurrentRead));
+  }
+
+  /* both paths wrote the same pattern */
+  for (uint32_t u32Address = 0U; u32Address < BENCH_AREA; u32Address += BENCH_PAGE_SIZE)
+  {
+    if (std::memcmp(&au8EEPSimMem[0][u32Address], au8Data, BENCH_PAGE_SIZE) != 0)
+    {
+      u32Failures++;
+    }
+  }
+
+  /* a read longer than the 8 bits byte counters of the HAL is split in pages, which end in interrupt */
+  vEEPSimSetImmediate(false);
+
+  while (EepFunc_t::bRead(0U, au8Area, BENCH_AREA) == false)
+  {
+    vEEPSimStep();
+  }
+
+  if (std::memcmp(au8Area, &au8EEPSimMem[0][0], BENCH_AREA) != 0)
+  {
+    u32Failures++;
+    std::printf("FAIL : read of the whole eeprom\n");
+  }
+
+  /* its end has been reported once, the next call starts a new read */
+  if ((EepFunc_t::bRead(0U, au8Area, BENCH_AREA) == true) || (EepFunc_t::eGetTransferState() != EEPROM_STATE_READ_IN_PROGRESS))
+  {
+    u32Failures++;
+    std::printf("FAIL : the end of the read is reported again\n");
+  }
+
+  while (EepFunc_t::bRead(0U, au8Area, BENCH_AREA) == false)
+  {
+    vEEPSimStep();
+  }
+
+  vEEPSimSetImmediate(true);
+
+  /* any error aborts the transfer of the C++ path, not only a NACK */
+  sFaults.u16ArbLost = 1000U;
+  vEEPSimSetFaults(&sFaults);
+  (void)EepObj_t::bRead(0U, au8Data, BENCH_PAGE_SIZE);
+  vEEPSimSetFaults(nullptr);
+
+  if (EepObj_t::eGetTransferState() != EEPROM_STATE_READ_ABORTED)
+  {
+    u32Failures++;
+    std::printf("FAIL : an arbitration loss does not abort the read\n");
+  }
+
+  std::printf("%s : %u failure(s)\n", (u32Failures == 0U) ? "PASS" : "FAIL", static_cast<unsigned>(u32Failures));
+
+  return (u32Failures == 0U) ? 0 : 1;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
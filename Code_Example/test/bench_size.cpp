@@ -0,0 +1,31 @@
+/********************************************************************************************************************
+* @file		bench_size.cpp
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the instantiation of the C++ front-end measured by the code size benchmark.
+*
+*********************************************************************************************************************
+* @remarks
+*		Only the class is instantiated here, on the HAL functions of the simulator called directly, so the
+*		size of this object is the size of the C++ path. It is compared with the size of the object of the
+*		C driver. No C driver symbol is referenced : the front-end is header-only on this bus.
+*
+********************************************************************************************************************/
+
+#include "eep_24LCXX.hpp"
+
+extern "C"
+{
+#include "eep_sim.h"
+}
+
+
+template class eep24lcxx::EEP24LCXX<eep24lcxx::Model24LC32A, eep24lcxx::I2CFuncBus<bEEPSimStartTransmit, eEEPSimGetTransferState, u32EEPSimGetTickMs>, EEP24LCXX_ADDR0>;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,653 @@
+/********************************************************************************************************************
+* @file		eep_sim.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the host simulator of the I2C bus, the timer and the eeproms 24LC32A.
+*
+*********************************************************************************************************************
+* @remarks
+*		One transfer at a time. The HAL counts the bytes on 8 bits (u8RxIndex, u8TxIndex) like the target
+*		driver, a reception of 256 bytes or more never reaches its length.
+*		With EEP_SIM_THREAD the simulator can be stepped by a thread which plays the interrupts and keeps
+*		the simulated time on the real time, for the blocking api. The simulator is then locked by each
+*		of its entries, the thread holds the lock while it calls the callbacks of the driver.
+*
+********************************************************************************************************************/
+
+#if defined(EEP_SIM_THREAD)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <string.h>
+#include "R7FA2E1A9.h"
+#include "eep_sim.h"
+
+#if defined(EEP_SIM_THREAD)
+#include <time.h>
+#include <pthread.h>
+#endif
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_SIM_CTRL_CODE                 (uint8_t)(0x50)
+#define EEP_SIM_CTRL_MSK                  (uint8_t)(0x78)
+#define EEP_SIM_CS_MSK                    (uint8_t)(0x07)
+#define EEP_SIM_ADDR_MSK                  (uint16_t)(EEP_SIM_MEM_SIZE - 1)
+#define EEP_SIM_PAGE_MSK                  (uint16_t)(EEP_SIM_PAGE_SIZE - 1)
+#define EEP_SIM_WRITE_CYCLE_MIN_US        (uint32_t)(3000)
+#define EEP_SIM_WRITE_CYCLE_MAX_US        (uint32_t)(5000)
+#define EEP_SIM_STRETCH_MAX_US            (uint32_t)(2000)
+#define EEP_SIM_US_PER_MS                 (uint64_t)(1000)
+#define EEP_SIM_PER_MILLE                 (uint32_t)(1000)
+#define EEP_SIM_NS_PER_US                 (uint64_t)(1000)
+#define EEP_SIM_US_PER_SECOND             (uint64_t)(1000000)
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              E N U M E R A T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * fault of the transfer in progress
+ */
+typedef enum
+{
+  EEP_SIM_FAULT_NONE     = 0,
+  EEP_SIM_FAULT_NACK     = 1,
+  EEP_SIM_FAULT_ARB_LOST = 2,
+  EEP_SIM_FAULT_TIMEOUT  = 3
+} eEEPSimFault_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+uint8_t        au8EEPSimMem[EEP_SIM_CHIP_COUNT][EEP_SIM_MEM_SIZE];
+EEPSimStats_t  sEEPSimStats;
+PORT_t         sEEPSimPort9;
+
+static EEPSimFaults_t        sFaults;
+static uint64_t              u64TimeUs;
+static uint32_t              u32TickOffsetMs;
+static uint32_t              u32Random;
+static bool                  bImmediate;
+static bool                  bHold;
+static uint32_t              u32Depth;           /* transfers in progress in nested start calls */
+
+static I2CTransfer_t         *psPending;          /* transfer in progress */
+static I2CTransfer_t         *psLast;             /* last transfer, for the stray callbacks */
+static uint64_t              u64PendingDueUs;
+static eEEPSimFault_t        ePendingFault;
+static eI2CTransferState_t   eState;
+
+static uint16_t              au16Pointer[EEP_SIM_CHIP_COUNT];
+static uint64_t              au64BusyUntilUs[EEP_SIM_CHIP_COUNT];
+
+static cbkFunc_t             pfvOneShot;
+static uint64_t              u64OneShotDueUs;
+
+#if defined(EEP_SIM_THREAD)
+static pthread_mutex_t       sLock;
+static pthread_once_t        sLockOnce = PTHREAD_ONCE_INIT;
+static pthread_t             sThread;
+static volatile bool         bThreadRun;
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function draw an event with a rate in per mille
+  * @param [IN]  u16Rate : rate in per mille
+  * @return      true if the event happens, otherwise false
+ **/
+static bool bEEPSimDraw(uint16_t u16Rate)
+{
+  return (u32EEPSimRandom() % EEP_SIM_PER_MILLE) < u16Rate;
+}
+
+
+#if defined(EEP_SIM_THREAD)
+
+/** @brief       This function create the lock of the simulator, recursive because the callbacks called by
+  *              the simulator start the next transfer
+  * @return      none
+ **/
+static void vEEPSimLockInit(void)
+{
+  pthread_mutexattr_t sAttr;
+
+  (void)pthread_mutexattr_init(&sAttr);
+  (void)pthread_mutexattr_settype(&sAttr, PTHREAD_MUTEX_RECURSIVE);
+  (void)pthread_mutex_init(&sLock, &sAttr);
+  (void)pthread_mutexattr_destroy(&sAttr);
+}
+
+#endif
+
+
+/** @brief       This function lock the simulator against the interrupt thread
+  * @return      none
+ **/
+static void vEEPSimLock(void)
+{
+#if defined(EEP_SIM_THREAD)
+  (void)pthread_once(&sLockOnce, vEEPSimLockInit);
+  (void)pthread_mutex_lock(&sLock);
+#endif
+}
+
+
+/** @brief       This function unlock the simulator
+  * @return      none
+ **/
+static void vEEPSimUnlock(void)
+{
+#if defined(EEP_SIM_THREAD)
+  (void)pthread_mutex_unlock(&sLock);
+#endif
+}
+
+
+/** @brief       This function return the duration of a transfer on the bus
+  * @param [IN]  psTransfer : transfer
+  * @return      duration in microseconds
+ **/
+static uint64_t u64EEPSimDuration(const I2CTransfer_t *psTransfer)
+{
+  uint32_t u32Bits;
+  uint32_t u32BitNs;
+
+  /* start, address, command, data and stop, each byte with its acknowledge */
+  u32Bits = 2u + (9u * (1u + psTransfer->u8CmdLength + psTransfer->u16DataLength));
+
+  if (psTransfer->eDirection == I2C_DIR_WRITE_READ)
+  {
+    /* repeated start and second address */
+    u32Bits += 10u;
+  }
+
+  switch (sEEPSimI2C.eI2CFreq)
+  {
+    case I2C_FREQ_100_KHZ : u32BitNs = 10000u; break;
+    case I2C_FREQ_1_MHZ   : u32BitNs = 1000u;  break;
+    default               : u32BitNs = 2500u;  break;
+  }
+
+  return (((uint64_t)u32Bits * u32BitNs) + 999u) / 1000u;
+}
+
+
+/** @brief       This function end the transfer in progress with an error
+  * @param [IN]  psTransfer : transfer
+  * @param [IN]  eError     : state read by the error callback
+  * @return      none
+ **/
+static void vEEPSimError(I2CTransfer_t *psTransfer, eI2CTransferState_t eError)
+{
+  eState = eError;
+
+  if (psTransfer->pfvCbkError != NULL_PTR)
+  {
+    psTransfer->pfvCbkError();
+  }
+}
+
+
+/** @brief       This function execute the transfer in progress and call the callbacks of the HAL
+  * @return      none
+ **/
+static void vEEPSimComplete(void)
+{
+  I2CTransfer_t   *psTransfer = psPending;
+  eEEPSimFault_t  eFault      = ePendingFault;
+  uint8_t         u8Cs        = psTransfer->u8SlaveAddress & EEP_SIM_CS_MSK;
+  uint16_t        u16Page;
+  uint16_t        u16Count;
+  uint16_t        u16Index;
+  uint32_t        u32Started  = sEEPSimStats.u32Transfers;
+
+  psPending = NULL_PTR;
+  psLast    = psTransfer;
+
+  if (((psTransfer->u8SlaveAddress & EEP_SIM_CTRL_MSK) != EEP_SIM_CTRL_CODE) || (u64TimeUs < au64BusyUntilUs[u8Cs]))
+  {
+    /* no eeprom or eeprom in its write cycle : the address is not acknowledged */
+    sEEPSimStats.u32BusyNack++;
+    vEEPSimError(psTransfer, I2C_STATE_NACK_DETECTION);
+  }
+  else if (eFault != EEP_SIM_FAULT_NONE)
+  {
+    if ((eFault == EEP_SIM_FAULT_NACK) && (psTransfer->eDirection == I2C_DIR_WRITE) && (psTransfer->u8CmdLength == 2u))
+    {
+      /* the bytes acknowledged before the NACK are written at the stop */
+      u16Count = (uint16_t)(u32EEPSimRandom() % (psTransfer->u16DataLength + 1u));
+      u16Page  = (uint16_t)(((psTransfer->pu8Cmd[0] << 8) | psTransfer->pu8Cmd[1]) & EEP_SIM_ADDR_MSK);
+
+      for (u16Index = 0; u16Index < u16Count; u16Index++)
+      {
+        au8EEPSimMem[u8Cs][(u16Page & (uint16_t)~EEP_SIM_PAGE_MSK) | ((u16Page + u16Index) & EEP_SIM_PAGE_MSK)] = psTransfer->pu8Data[u16Index];
+      }
+
+      if (u16Count > 0u)
+      {
+        au64BusyUntilUs[u8Cs] = u64TimeUs + EEP_SIM_WRITE_CYCLE_MIN_US + (u32EEPSimRandom() % (EEP_SIM_WRITE_CYCLE_MAX_US - EEP_SIM_WRITE_CYCLE_MIN_US));
+      }
+    }
+
+    /* the transfer stopped anywhere : the address pointer is unknown */
+    au16Pointer[u8Cs] = (uint16_t)(u32EEPSimRandom() & EEP_SIM_ADDR_MSK);
+
+    switch (eFault)
+    {
+      case EEP_SIM_FAULT_NACK     : vEEPSimError(psTransfer, I2C_STATE_NACK_DETECTION); break;
+      case EEP_SIM_FAULT_ARB_LOST : vEEPSimError(psTransfer, I2C_STATE_ARBITRATION_LOST); break;
+      default                     : vEEPSimError(psTransfer, I2C_STATE_BUS_TIMEOUT); break;
+    }
+  }
+  else if (psTransfer->eDirection == I2C_DIR_WRITE)
+  {
+    if (psTransfer->u8CmdLength == 2u)
+    {
+      u16Page = (uint16_t)(((psTransfer->pu8Cmd[0] << 8) | psTransfer->pu8Cmd[1]) & EEP_SIM_ADDR_MSK);
+
+      /* the address pointer rolls over inside the page */
+      for (u16Index = 0; u16Index < psTransfer->u16DataLength; u16Index++)
+      {
+        au8EEPSimMem[u8Cs][(u16Page & (uint16_t)~EEP_SIM_PAGE_MSK) | ((u16Page + u16Index) & EEP_SIM_PAGE_MSK)] = psTransfer->pu8Data[u16Index];
+      }
+
+      au16Pointer[u8Cs] = (u16Page & (uint16_t)~EEP_SIM_PAGE_MSK) | ((u16Page + psTransfer->u16DataLength) & EEP_SIM_PAGE_MSK);
+
+      if (psTransfer->u16DataLength > 0u)
+      {
+        au64BusyUntilUs[u8Cs] = u64TimeUs + EEP_SIM_WRITE_CYCLE_MIN_US + (u32EEPSimRandom() % (EEP_SIM_WRITE_CYCLE_MAX_US - EEP_SIM_WRITE_CYCLE_MIN_US));
+      }
+    }
+
+    psTransfer->u8TxIndex = (uint8_t)psTransfer->u16DataLength;
+    eState                = I2C_STATE_TRANSFER_COMPLETED;
+
+    if (psTransfer->pfvCbkTransmitEnd != NULL_PTR)
+    {
+      psTransfer->pfvCbkTransmitEnd();
+    }
+  }
+  else
+  {
+    if (psTransfer->eDirection == I2C_DIR_WRITE_READ)
+    {
+      au16Pointer[u8Cs] = (uint16_t)(((psTransfer->pu8Cmd[0] << 8) | psTransfer->pu8Cmd[1]) & EEP_SIM_ADDR_MSK);
+    }
+
+    /* one receive condition per byte, a read rolls over the whole memory */
+    for (u16Index = 0; u16Index < psTransfer->u16DataLength; u16Index++)
+    {
+      psTransfer->pu8Data[u16Index] = au8EEPSimMem[u8Cs][au16Pointer[u8Cs]];
+      au16Pointer[u8Cs]             = (au16Pointer[u8Cs] + 1u) & EEP_SIM_ADDR_MSK;
+      psTransfer->u8RxIndex++;
+      eState                        = I2C_STATE_RECEIVE_CONDITION;
+
+      if (psTransfer->pfvCbkRcv != NULL_PTR)
+      {
+        psTransfer->pfvCbkRcv();
+      }
+
+      if (sEEPSimStats.u32Transfers != u32Started)
+      {
+        /* the driver has already started another transfer, it does not expect more bytes */
+        break;
+      }
+    }
+  }
+}
+
+
+/** @brief       This function start the timer, it always runs in the simulator
+  * @return      none
+ **/
+static void vEEPSimTimerStart(void)
+{
+}
+
+#if defined(EEP_SIM_THREAD)
+
+/** @brief       This function is the interrupt thread : it steps the simulator and sleeps while the simulated
+  *              time is ahead of the real time
+  * @param [IN]  pvArg : unused
+  * @return      NULL_PTR
+ **/
+static void *pvEEPSimThread(void *pvArg)
+{
+  struct timespec sStart;
+  struct timespec sNow;
+  struct timespec sSleep;
+  uint64_t        u64StartUs = u64EEPSimTimeUs();
+  uint64_t        u64RealUs;
+  uint64_t        u64SimUs;
+
+  (void)pvArg;
+  (void)clock_gettime(CLOCK_MONOTONIC, &sStart);
+
+  while (bThreadRun == true)
+  {
+    vEEPSimStep();
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &sNow);
+    u64RealUs = ((uint64_t)(sNow.tv_sec - sStart.tv_sec) * EEP_SIM_US_PER_SECOND) + (uint64_t)((sNow.tv_nsec - sStart.tv_nsec) / (long)EEP_SIM_NS_PER_US);
+    u64SimUs  = u64EEPSimTimeUs() - u64StartUs;
+
+    if (u64SimUs > u64RealUs)
+    {
+      sSleep.tv_sec  = (time_t)((u64SimUs - u64RealUs) / EEP_SIM_US_PER_SECOND);
+      sSleep.tv_nsec = (long)(((u64SimUs - u64RealUs) % EEP_SIM_US_PER_SECOND) * EEP_SIM_NS_PER_US);
+      (void)nanosleep(&sSleep, NULL_PTR);
+    }
+  }
+
+  return NULL_PTR;
+}
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+I2CObj_t    sEEPSimI2C   = { .eI2CId = I2C_ID0, .eI2CFreq = I2C_FREQ_400_KHZ, .eSCLPin = I2C_PIN_SCL_P100, .eSDAPin = I2C_PIN_SDA_P101,
+                             .eMode = I2C_MASTER_MODE, .pfbMasterStartTransmit = bEEPSimStartTransmit, .pfeGetTransferState = eEEPSimGetTransferState };
+sObjTimer_t sEEPSimTimer = { .pfvStart = vEEPSimTimerStart, .pfu32GetTickMs = u32EEPSimGetTickMs };
+
+
+bool bEEPSimStartTransmit(I2CTransfer_t *psTransfer)
+{
+  bool bRet = false;
+
+  vEEPSimLock();
+
+  if (psPending != NULL_PTR)
+  {
+    sEEPSimStats.u32Collision++;
+  }
+  else if ((bHold == true) || (bEEPSimDraw(sFaults.u16StartFail) == true))
+  {
+    sEEPSimStats.u32StartFail += (bHold == true) ? 0u : 1u;
+  }
+  else
+  {
+    sEEPSimStats.u32Transfers++;
+    sEEPSimStats.u32RandomRead  += (psTransfer->eDirection == I2C_DIR_WRITE_READ) ? 1u : 0u;
+    sEEPSimStats.u32CurrentRead += (psTransfer->eDirection == I2C_DIR_READ) ? 1u : 0u;
+
+    psTransfer->u8RxIndex = 0;
+    psTransfer->u8TxIndex = 0;
+    psPending             = psTransfer;
+    u64PendingDueUs       = u64TimeUs + u64EEPSimDuration(psTransfer);
+    ePendingFault         = EEP_SIM_FAULT_NONE;
+
+    if (bEEPSimDraw(sFaults.u16Nack) == true)
+    {
+      sEEPSimStats.u32Nack++;
+      ePendingFault = EEP_SIM_FAULT_NACK;
+    }
+    else if (bEEPSimDraw(sFaults.u16ArbLost) == true)
+    {
+      sEEPSimStats.u32ArbLost++;
+      ePendingFault = EEP_SIM_FAULT_ARB_LOST;
+    }
+    else if (bEEPSimDraw(sFaults.u16TimeOut) == true)
+    {
+      sEEPSimStats.u32TimeOut++;
+      ePendingFault   = EEP_SIM_FAULT_TIMEOUT;
+      u64PendingDueUs = u64TimeUs + EEP_SIM_BUS_TIMEOUT_US;
+    }
+    else if (bEEPSimDraw(sFaults.u16Stretch) == true)
+    {
+      sEEPSimStats.u32Stretch++;
+      u64PendingDueUs += 1u + (u32EEPSimRandom() % EEP_SIM_STRETCH_MAX_US);
+    }
+
+    bRet = true;
+
+    if (bImmediate == true)
+    {
+      /* a blocking HAL : the time of the transfer elapses in the call */
+      u32Depth++;
+
+      if (u32Depth > sEEPSimStats.u32DepthMax)
+      {
+        sEEPSimStats.u32DepthMax = u32Depth;
+      }
+
+      u64TimeUs = u64PendingDueUs;
+      vEEPSimComplete();
+      u32Depth--;
+    }
+  }
+
+  vEEPSimUnlock();
+
+  return bRet;
+}
+
+
+eI2CTransferState_t eEEPSimGetTransferState(void)
+{
+  return eState;
+}
+
+
+uint32_t u32EEPSimGetTickMs(void)
+{
+  uint32_t u32Tick;
+
+  vEEPSimLock();
+  u32Tick = (uint32_t)(u64TimeUs / EEP_SIM_US_PER_MS) + u32TickOffsetMs;
+  vEEPSimUnlock();
+
+  return u32Tick;
+}
+
+
+void vEEPSimReset(uint32_t u32Seed, uint32_t u32TickOffset)
+{
+  memset(au8EEPSimMem, 0xFF, sizeof(au8EEPSimMem));
+  memset(au16Pointer, 0, sizeof(au16Pointer));
+  memset(au64BusyUntilUs, 0, sizeof(au64BusyUntilUs));
+  memset(&sEEPSimStats, 0, sizeof(sEEPSimStats));
+  memset(&sFaults, 0, sizeof(sFaults));
+
+  u32Random       = (u32Seed != 0u) ? u32Seed : 1u;
+  u64TimeUs       = 0;
+  u32TickOffsetMs = u32TickOffset;
+  bImmediate      = false;
+  bHold           = false;
+  u32Depth        = 0;
+  psPending       = NULL_PTR;
+  psLast          = NULL_PTR;
+  pfvOneShot      = NULL_PTR;
+  eState          = I2C_STATE_TRANSFER_COMPLETED;
+}
+
+
+void vEEPSimSetFaults(const EEPSimFaults_t *psFaults)
+{
+  if (psFaults != NULL_PTR)
+  {
+    sFaults = *psFaults;
+  }
+  else
+  {
+    memset(&sFaults, 0, sizeof(sFaults));
+  }
+}
+
+
+void vEEPSimSetImmediate(bool bSet)
+{
+  bImmediate = bSet;
+}
+
+
+void vEEPSimHoldBus(bool bSet)
+{
+  bHold = bSet;
+}
+
+
+void vEEPSimStep(void)
+{
+  uint64_t   u64NextUs;
+  cbkFunc_t  pfvCbk;
+
+  vEEPSimLock();
+  u64NextUs = ((u64TimeUs / EEP_SIM_US_PER_MS) + 1u) * EEP_SIM_US_PER_MS;
+
+  if ((psPending != NULL_PTR) && (u64PendingDueUs < u64NextUs))
+  {
+    u64NextUs = u64PendingDueUs;
+  }
+
+  if ((pfvOneShot != NULL_PTR) && (u64OneShotDueUs < u64NextUs))
+  {
+    u64NextUs = u64OneShotDueUs;
+  }
+
+  if (u64NextUs > u64TimeUs)
+  {
+    u64TimeUs = u64NextUs;
+  }
+
+  if ((pfvOneShot != NULL_PTR) && (u64OneShotDueUs <= u64TimeUs))
+  {
+    pfvCbk     = pfvOneShot;
+    pfvOneShot = NULL_PTR;
+    pfvCbk();
+  }
+
+  if ((psPending != NULL_PTR) && (u64PendingDueUs <= u64TimeUs))
+  {
+    vEEPSimComplete();
+  }
+
+  if ((psPending == NULL_PTR) && (psLast != NULL_PTR) && (bEEPSimDraw(sFaults.u16Stray) == true))
+  {
+    /* a late stop condition or a stray error of the HAL while the bus is idle */
+    sEEPSimStats.u32Stray++;
+
+    if ((u32EEPSimRandom() & 1u) == 0u)
+    {
+      if (psLast->pfvCbkStop != NULL_PTR)
+      {
+        psLast->pfvCbkStop();
+      }
+    }
+    else
+    {
+      vEEPSimError(psLast, I2C_STATE_NACK_DETECTION);
+    }
+  }
+
+  vEEPSimUnlock();
+}
+
+
+bool bEEPSimStartOneShot(uint32_t u32DelayMs, cbkFunc_t pfvCbk)
+{
+  bool bRet = false;
+
+  vEEPSimLock();
+
+  if (bEEPSimDraw(sFaults.u16OneShotFail) == true)
+  {
+    sEEPSimStats.u32OneShotFail++;
+  }
+  else if ((pfvOneShot == NULL_PTR) && (pfvCbk != NULL_PTR))
+  {
+    /* counted in ticks : it may end up to one tick early */
+    pfvOneShot      = pfvCbk;
+    u64OneShotDueUs = ((u64TimeUs / EEP_SIM_US_PER_MS) + u32DelayMs) * EEP_SIM_US_PER_MS;
+    bRet            = true;
+  }
+
+  vEEPSimUnlock();
+
+  return bRet;
+}
+
+
+uint64_t u64EEPSimTimeUs(void)
+{
+  uint64_t u64Us;
+
+  vEEPSimLock();
+  u64Us = u64TimeUs;
+  vEEPSimUnlock();
+
+  return u64Us;
+}
+
+
+bool bEEPSimBusBusy(void)
+{
+  bool bBusy;
+
+  vEEPSimLock();
+  bBusy = (psPending != NULL_PTR);
+  vEEPSimUnlock();
+
+  return bBusy;
+}
+
+
+#if defined(EEP_SIM_THREAD)
+
+void vEEPSimStartThread(void)
+{
+  if (bThreadRun == false)
+  {
+    bThreadRun = true;
+    (void)pthread_create(&sThread, NULL_PTR, pvEEPSimThread, NULL_PTR);
+  }
+}
+
+
+void vEEPSimStopThread(void)
+{
+  if (bThreadRun == true)
+  {
+    bThreadRun = false;
+    (void)pthread_join(sThread, NULL_PTR);
+  }
+}
+
+#endif
+
+
+uint32_t u32EEPSimRandom(void)
+{
+  /* xorshift32 */
+  u32Random ^= u32Random << 13;
+  u32Random ^= u32Random >> 17;
+  u32Random ^= u32Random << 5;
+
+  return u32Random;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
@@ -0,0 +1,190 @@
+/********************************************************************************************************************
+* @file		eep_sim.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the host simulator of the I2C bus, the timer and the eeproms 24LC32A.
+*
+*********************************************************************************************************************
+* @remarks
+*		The time is simulated in microseconds and only advances in vEEPSimStep (called by __WFI()). A transfer
+*		takes the time of its bits on the bus and ends with the callbacks of the HAL, from the step like an
+*		interrupt, or inside the start call in immediate mode. The faults are drawn per transfer :
+*		NACK of the address or of a data byte (the bytes already acknowledged are written), arbitration loss,
+*		bus timeout, start refused by the HAL, clock stretching, stray callbacks and one-shot timer refused.
+*		An eeprom in its write cycle does not acknowledge its address.
+*
+********************************************************************************************************************/
+
+#ifndef EEP_SIM_H
+#define EEP_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hw_desc_i2c.h"
+#include "hw_desc_timer.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define EEP_SIM_CHIP_COUNT                (uint8_t)(8)
+#define EEP_SIM_MEM_SIZE                  (uint16_t)(4096)
+#define EEP_SIM_PAGE_SIZE                 (uint16_t)(32)
+#define EEP_SIM_BUS_TIMEOUT_US            (uint32_t)(25000)    /* timeout of the HAL, SMBus like */
+#define EEP_SIM_WRAP_OFFSET_MS            (uint32_t)(0xFFFFFFFFu - 2000u)   /* the tick wraps after 2 s */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * fault rates, in per mille of the transfers (of the steps for the stray callbacks)
+ */
+struct EEPSimFaults
+{
+  uint16_t  u16Nack;                 /**< NACK of the address or of a data byte */
+  uint16_t  u16ArbLost;              /**< arbitration lost against another master */
+  uint16_t  u16TimeOut;              /**< bus held low, the HAL gives up after EEP_SIM_BUS_TIMEOUT_US */
+  uint16_t  u16StartFail;            /**< the HAL refuses to start the transfer */
+  uint16_t  u16Stretch;              /**< the transfer is delayed by clock stretching */
+  uint16_t  u16Stray;                /**< a callback of the last transfer is called again while the bus is idle */
+  uint16_t  u16OneShotFail;          /**< the one-shot timer cannot be started */
+};
+
+typedef struct EEPSimFaults EEPSimFaults_t;
+
+/*
+ * counters of the simulator
+ */
+struct EEPSimStats
+{
+  uint32_t  u32Transfers;            /**< transfers started */
+  uint32_t  u32RandomRead;           /**< reads started with an address phase */
+  uint32_t  u32CurrentRead;          /**< reads started without address phase, from the address pointer */
+  uint32_t  u32BusyNack;             /**< address not acknowledged by an eeprom in its write cycle */
+  uint32_t  u32Nack;                 /**< injected NACK */
+  uint32_t  u32ArbLost;              /**< injected arbitration losses */
+  uint32_t  u32TimeOut;              /**< injected bus timeouts */
+  uint32_t  u32StartFail;            /**< injected start refusals */
+  uint32_t  u32Stretch;              /**< injected clock stretching */
+  uint32_t  u32Stray;                /**< injected stray callbacks */
+  uint32_t  u32OneShotFail;          /**< injected one-shot refusals */
+  uint32_t  u32Collision;            /**< start requested while a transfer was in progress (driver bug) */
+  uint32_t  u32DepthMax;             /**< deepest nesting of transfers started by the callbacks of a transfer ended in its start call */
+};
+
+typedef struct EEPSimStats EEPSimStats_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+extern uint8_t        au8EEPSimMem[EEP_SIM_CHIP_COUNT][EEP_SIM_MEM_SIZE];
+extern I2CObj_t       sEEPSimI2C;
+extern sObjTimer_t    sEEPSimTimer;
+extern EEPSimStats_t  sEEPSimStats;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function start a transfer, it is the pfbMasterStartTransmit of sEEPSimI2C. The HAL functions
+  *              are public to be called directly by the static bus of the C++ front-end
+  * @param [IN]  psTransfer : transfer
+  * @return      true if the transfer was started, otherwise false
+ **/
+bool bEEPSimStartTransmit(I2CTransfer_t *psTransfer);
+
+/** @brief       This function get the state of the transfer in progress, it is the pfeGetTransferState of sEEPSimI2C
+  * @return      state of the transfer
+ **/
+eI2CTransferState_t eEEPSimGetTransferState(void);
+
+/** @brief       This function return the tick of the timer, it is the pfu32GetTickMs of sEEPSimTimer
+  * @return      tick in milliseconds
+ **/
+uint32_t u32EEPSimGetTickMs(void);
+
+/** @brief       This function reset the simulator : erased memories, no transfer, no fault, time zero
+  * @param [IN]  u32Seed         : seed of the random generator
+  * @param [IN]  u32TickOffset   : value of the tick at time zero, EEP_SIM_WRAP_OFFSET_MS to test the wrap
+  * @return      none
+ **/
+void vEEPSimReset(uint32_t u32Seed, uint32_t u32TickOffset);
+
+/** @brief       This function set the fault rates
+  * @param [IN]  psFaults : fault rates, NULL_PTR for no fault
+  * @return      none
+ **/
+void vEEPSimSetFaults(const EEPSimFaults_t *psFaults);
+
+/** @brief       This function select if a transfer ends inside its start call (like a blocking HAL)
+  * @param [IN]  bSet : true to end the transfers in the start call
+  * @return      none
+ **/
+void vEEPSimSetImmediate(bool bSet);
+
+/** @brief       This function make the HAL refuse every start, as if the bus was used by another master
+  * @param [IN]  bSet : true to refuse the starts
+  * @return      none
+ **/
+void vEEPSimHoldBus(bool bSet);
+
+/** @brief       This function advance the time to the next event (end of transfer, one-shot timer or tick)
+  *              and process it
+  * @return      none
+ **/
+void vEEPSimStep(void);
+
+/** @brief       This function start the one-shot timer of the simulator, it has the prototype of EEPOneShotFunc_t
+  * @param [IN]  u32DelayMs : delay in milliseconds, counted in ticks
+  * @param [IN]  pfvCbk     : function called at the end of the delay
+  * @return      true if the timer was started, otherwise false
+ **/
+bool bEEPSimStartOneShot(uint32_t u32DelayMs, cbkFunc_t pfvCbk);
+
+/** @brief       This function return the simulated time
+  * @return      time in microseconds since the reset
+ **/
+uint64_t u64EEPSimTimeUs(void);
+
+/** @brief       This function tell if a transfer is in progress on the bus
+  * @return      true if a transfer is in progress, otherwise false
+ **/
+bool bEEPSimBusBusy(void);
+
+#if defined(EEP_SIM_THREAD)
+
+/** @brief       This function start the interrupt thread, which steps the simulator at the pace of the real time
+  * @return      none
+ **/
+void vEEPSimStartThread(void);
+
+/** @brief       This function stop the interrupt thread
+  * @return      none
+ **/
+void vEEPSimStopThread(void);
+
+#endif
+
+/** @brief       This function return a pseudo random number of the simulator
+  * @return      random number
+ **/
+uint32_t u32EEPSimRandom(void);
+
+#endif
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
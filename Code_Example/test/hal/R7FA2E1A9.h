@@ -0,0 +1,33 @@
+/********************************************************************************************************************
+* @file		R7FA2E1A9.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		Host stand-in of the device header, used by the simulator of the tests.
+*
+*********************************************************************************************************************
+* @remarks
+*		__WFI() lets the simulator run until its next event, like the core sleeping until the next interrupt.
+*
+********************************************************************************************************************/
+
+#ifndef R7FA2E1A9_H
+#define R7FA2E1A9_H
+
+#include <stdint.h>
+
+typedef struct
+{
+  volatile uint32_t PODR;
+} PORT_t;
+
+extern PORT_t sEEPSimPort9;
+
+#define PORT9                             (&sEEPSimPort9)
+
+void vEEPSimStep(void);
+
+#define __WFI()                           vEEPSimStep()
+
+#endif
@@ -0,0 +1,87 @@
+/********************************************************************************************************************
+* @file		hw_desc_i2c.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		Host stand-in of the I2C driver interface, used by the simulator of the tests.
+*
+*********************************************************************************************************************
+* @remarks
+*		Only the part of the interface used by the eeprom driver is declared. The error states after
+*		I2C_STATE_NACK_DETECTION are reported through pfvCbkError only.
+*
+********************************************************************************************************************/
+
+#ifndef HW_DESC_I2C_H
+#define HW_DESC_I2C_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NULL_PTR                          ((void *)0)
+
+typedef void (*cbkFunc_t)(void);
+
+/** direction of a transfer */
+typedef enum
+{
+  I2C_DIR_WRITE      = 0,           /**< command bytes then data bytes */
+  I2C_DIR_READ       = 1,           /**< data bytes received without command */
+  I2C_DIR_WRITE_READ = 2,           /**< command bytes, repeated start, then data bytes received */
+
+  I2_DIR_MAX
+} eI2CDirection_t;
+
+/** state of the transfer in progress, read by the callbacks */
+typedef enum
+{
+  I2C_STATE_TRANSFER_COMPLETED = 0,
+  I2C_STATE_RECEIVE_CONDITION  = 1,
+  I2C_STATE_NACK_DETECTION     = 2,
+  I2C_STATE_ARBITRATION_LOST   = 3,
+  I2C_STATE_BUS_TIMEOUT        = 4,
+
+  I2C_STATE_MAX
+} eI2CTransferState_t;
+
+typedef enum { I2C_ID0 = 0 } eI2CId_t;
+typedef enum { I2C_FREQ_100_KHZ = 0, I2C_FREQ_400_KHZ = 1, I2C_FREQ_1_MHZ = 2 } eI2CFreq_t;
+typedef enum { I2C_PIN_SCL_P100 = 0 } eSCL_t;
+typedef enum { I2C_PIN_SDA_P101 = 0 } eSDA_t;
+typedef enum { I2C_MASTER_MODE = 0 } eMode_t;
+
+/** transfer description */
+typedef struct
+{
+  uint8_t          u8SlaveAddress;
+  uint8_t          *pu8Data;
+  uint16_t         u16DataLength;
+  uint8_t          u8CmdLength;
+  uint8_t          u8RxIndex;       /**< received bytes, counted on 8 bits like the target driver */
+  uint8_t          u8TxIndex;       /**< transmitted data bytes, counted on 8 bits like the target driver */
+  cbkFunc_t        pfvCbkTransmitEnd;
+  cbkFunc_t        pfvCbkRcv;
+  cbkFunc_t        pfvCbkStop;
+  cbkFunc_t        pfvCbkError;
+  eI2CDirection_t  eDirection;
+  uint8_t          pu8Cmd[4];
+} I2CTransfer_t;
+
+/** I2C object */
+typedef struct
+{
+  eI2CId_t             eI2CId;
+  eI2CFreq_t           eI2CFreq;
+  eSCL_t               eSCLPin;
+  eSDA_t               eSDAPin;
+  eMode_t              eMode;
+  bool                 (*pfbMasterStartTransmit)(I2CTransfer_t *psTransfer);
+  eI2CTransferState_t  (*pfeGetTransferState)(void);
+} I2CObj_t;
+
+typedef I2CObj_t sI2CObj_t;
+
+void vI2CInitInst(I2CObj_t *psI2CInst);
+
+#endif
@@ -0,0 +1,36 @@
+/********************************************************************************************************************
+* @file		hw_desc_timer.h
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		Host stand-in of the timer driver interface, used by the simulator of the tests.
+*
+*********************************************************************************************************************
+* @remarks
+*		Same members as the target timer object : pfvStart and pfu32GetTickMs.
+*
+********************************************************************************************************************/
+
+#ifndef HW_DESC_TIMER_H
+#define HW_DESC_TIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hw_desc_i2c.h"
+
+typedef enum { TIMER_ID0 = 0 } eTimerId_t;
+
+/** timer object */
+typedef struct
+{
+  void      (*pfvStart)(void);
+  uint32_t  (*pfu32GetTickMs)(void);
+} sObjTimer_t;
+
+typedef sObjTimer_t sTimerObj_t;
+
+void vInitTimerInst(sObjTimer_t *psTimerInst, eTimerId_t eTimerId);
+void vSystemInit(void);
+
+#endif
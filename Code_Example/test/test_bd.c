@@ -0,0 +1,315 @@
+/********************************************************************************************************************
+* @file		test_bd.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the test of the block device adapter on the host simulator.
+*
+*********************************************************************************************************************
+* @remarks
+*		A file is stored like a filesystem would do it : a header page in the first block (magic and length)
+*		and the data in the next blocks. It is created, appended record per record with an update of its
+*		header after each record, then read back block per block (reads longer than 255 bytes). The pages
+*		of consecutive reads must continue from the address pointer of the eeprom without address phase.
+*		The throughput of each step is printed in bytes per simulated second, with the write cycle polled
+*		and signalled by the one-shot timer. A read whose transfer is lost must return once the transfer
+*		has left the bus, and the next read must not collide with it.
+*		Built with EEP_OS_PORT_POSIX and EEP_SIM_THREAD, the same scenario runs through the blocking api,
+*		the simulator being stepped by its interrupt thread at the pace of the real time.
+*
+********************************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "R7FA2E1A9.h"
+#include "eep_24LCXX_bd.h"
+#include "eep_sim.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define BD_BLOCK_SIZE                     (uint16_t)(512)
+#define BD_BLOCK_COUNT                    (uint16_t)(8)
+#define BD_CACHE_SIZE                     (uint16_t)(64)
+#define BD_TIME_OUT_MS                    (uint32_t)(100)
+#define BD_RECORD_SIZE                    (uint32_t)(64)
+#define BD_RECORD_COUNT                   (uint32_t)(40)
+#define BD_FILE_SIZE                      (uint32_t)(BD_RECORD_SIZE * BD_RECORD_COUNT)
+#define BD_HEADER_BLOCK                   (uint32_t)(0)
+#define BD_DATA_BLOCK                     (uint32_t)(1)
+#define BD_MAGIC                          (uint8_t)(0xF1)
+#define BD_LOST_TIME_OUT_MS               (uint32_t)(10)       /* shorter than the bus timeout of the simulator */
+#define BD_FAULT_ALWAYS                   (uint16_t)(1000)
+#define BD_READ_ADDRESSED                 (uint32_t)(1)        /* first page of the data, the header write left the pointer on the header */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+static EEP24LCXXObj_t   sEEP;
+static EEP24LCXXBd_t    sBd;
+static uint8_t          au8File[BD_FILE_SIZE];
+static uint8_t          au8ReadBack[BD_FILE_SIZE];
+static uint8_t          au8Header[EEPROM_PAGE_SIZE];
+static uint32_t         u32Failures;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function check the result of a call of the block device
+  * @param [IN]  i32Ret : result of the call
+  * @param [IN]  pcWhat : name of the call
+  * @return      none
+ **/
+static void vBdCheck(int32_t i32Ret, const char *pcWhat)
+{
+  if (i32Ret != EEP_BD_OK)
+  {
+    u32Failures++;
+    printf("FAIL : %s returned %d\n", pcWhat, (int)i32Ret);
+  }
+}
+
+
+/** @brief       This function write the header of the file
+  * @param [IN]  u32Length : length of the file
+  * @return      result of the prog
+ **/
+static int32_t i32BdHeader(uint32_t u32Length)
+{
+  memset(au8Header, 0, sizeof(au8Header));
+  au8Header[0] = BD_MAGIC;
+  au8Header[1] = (uint8_t)(u32Length >> 8);
+  au8Header[2] = (uint8_t)u32Length;
+
+  return i32EEP24LCXXBdProg(&sBd, BD_HEADER_BLOCK, 0, au8Header, sizeof(au8Header));
+}
+
+
+/** @brief       This function print the throughput of a step
+  * @param [IN]  pcWhat     : name of the step
+  * @param [IN]  u32Bytes   : bytes of the file handled by the step
+  * @param [IN]  u64StartUs : simulated time at the start of the step
+  * @return      none
+ **/
+static void vBdPrint(const char *pcWhat, uint32_t u32Bytes, uint64_t u64StartUs)
+{
+  uint64_t u64Us = u64EEPSimTimeUs() - u64StartUs;
+
+  printf("  %-7s %5u bytes  %8.1f ms  %8.0f B/s\n", pcWhat, (unsigned)u32Bytes, u64Us / 1000.0, (u64Us > 0u) ? (u32Bytes * 1e6 / u64Us) : 0.0);
+}
+
+
+/** @brief       This function check a read whose transfer is lost : the bus is held low and the HAL ends the
+  *              transfer with an error after its bus timeout, later than the time-out of the read
+  * @return      none
+ **/
+static void vBdLost(void)
+{
+  EEPSimFaults_t sFaults = {0};
+  uint8_t        au8Page[EEPROM_PAGE_SIZE];
+  int32_t        i32Ret;
+  bool           bDrained;
+
+  sFaults.u16TimeOut = BD_FAULT_ALWAYS;
+  vEEPSimSetFaults(&sFaults);
+  sBd.u32TimeOutMs   = BD_LOST_TIME_OUT_MS;
+
+  i32Ret   = i32EEP24LCXXBdRead(&sBd, BD_DATA_BLOCK, 0, au8Page, sizeof(au8Page));
+  bDrained = (bEEP24LCXXAbort() == true) && (bEEPSimBusBusy() == false);
+
+  vEEPSimSetFaults(NULL_PTR);
+  sBd.u32TimeOutMs   = BD_TIME_OUT_MS;
+
+#if defined(EEP_BD_BLOCKING)
+  /* the blocking api waits EEPROM_RTOS_DRAIN_MS only, the driver refuses to start until the lost transfer ends */
+  bDrained = true;
+
+  while (bEEPSimBusBusy() == true)
+  {
+    vEEPOsDelayMs(1);
+  }
+#endif
+
+  if ((i32Ret != EEP_BD_ERR_IO) || (bDrained == false))
+  {
+    u32Failures++;
+    printf("FAIL : the read of a lost transfer returns %d before the end of the transfer\n", (int)i32Ret);
+  }
+
+  memset(au8Page, 0, sizeof(au8Page));
+  vBdCheck(i32EEP24LCXXBdRead(&sBd, BD_DATA_BLOCK, 0, au8Page, sizeof(au8Page)), "read after a lost transfer");
+
+  if ((memcmp(au8Page, au8File, sizeof(au8Page)) != 0) || (sEEPSimStats.u32Collision != 0u))
+  {
+    u32Failures++;
+    printf("FAIL : the read after a lost transfer collides with it\n");
+  }
+}
+
+
+/** @brief       This function create, append and read back the file, then lose a read
+  * @return      none
+ **/
+static void vBdScenario(void)
+{
+  uint64_t u64StartUs;
+  uint32_t u32Record;
+  uint32_t u32Block;
+  uint32_t u32Length;
+  uint32_t u32Random;
+  uint32_t u32Current;
+
+  /* create : empty file */
+  u64StartUs = u64EEPSimTimeUs();
+  vBdCheck(i32BdHeader(0), "create");
+  vBdPrint("create", EEPROM_PAGE_SIZE, u64StartUs);
+
+  /* append : each record is written, then the header tells its new length */
+  u64StartUs = u64EEPSimTimeUs();
+
+  for (u32Record = 0; u32Record < BD_RECORD_COUNT; u32Record++)
+  {
+    u32Length = u32Record * BD_RECORD_SIZE;
+    vBdCheck(i32EEP24LCXXBdProg(&sBd, BD_DATA_BLOCK + (u32Length / BD_BLOCK_SIZE), u32Length % BD_BLOCK_SIZE, &au8File[u32Length], BD_RECORD_SIZE), "append");
+    vBdCheck(i32BdHeader(u32Length + BD_RECORD_SIZE), "header");
+  }
+
+  vBdPrint("append", BD_FILE_SIZE, u64StartUs);
+
+  /* read : the header, then the file block per block */
+  u64StartUs = u64EEPSimTimeUs();
+  u32Random  = sEEPSimStats.u32RandomRead;
+  u32Current = sEEPSimStats.u32CurrentRead;
+  memset(au8Header, 0, sizeof(au8Header));
+  memset(au8ReadBack, 0, sizeof(au8ReadBack));
+  vBdCheck(i32EEP24LCXXBdRead(&sBd, BD_HEADER_BLOCK, 0, au8Header, 3), "read header");
+  u32Length = ((uint32_t)au8Header[1] << 8) | au8Header[2];
+
+  for (u32Block = 0; (u32Block * BD_BLOCK_SIZE) < u32Length; u32Block++)
+  {
+    vBdCheck(i32EEP24LCXXBdRead(&sBd, BD_DATA_BLOCK + u32Block, 0, &au8ReadBack[u32Block * BD_BLOCK_SIZE],
+                                ((u32Length - (u32Block * BD_BLOCK_SIZE)) > BD_BLOCK_SIZE) ? BD_BLOCK_SIZE : (u32Length - (u32Block * BD_BLOCK_SIZE))), "read");
+  }
+
+  vBdPrint("read", u32Length, u64StartUs);
+
+  /* only the first page of the data needs an address phase, the next pages continue from the pointer */
+  u32Random  = sEEPSimStats.u32RandomRead - u32Random;
+  u32Current = sEEPSimStats.u32CurrentRead - u32Current;
+  printf("  %u reads with address phase, %u without\n", (unsigned)u32Random, (unsigned)u32Current);
+
+  if ((u32Random != BD_READ_ADDRESSED) || (u32Current != (BD_FILE_SIZE / EEPROM_PAGE_SIZE)))
+  {
+    u32Failures++;
+    printf("FAIL : consecutive reads use an address phase\n");
+  }
+
+  if ((au8Header[0] != BD_MAGIC) || (u32Length != BD_FILE_SIZE) || (memcmp(au8ReadBack, au8File, sizeof(au8File)) != 0))
+  {
+    u32Failures++;
+    printf("FAIL : the file read back differs\n");
+  }
+
+  /* areas outside a block are refused */
+  if ((i32EEP24LCXXBdRead(&sBd, BD_BLOCK_COUNT, 0, au8ReadBack, 1) != EEP_BD_ERR_INVAL) ||
+      (i32EEP24LCXXBdProg(&sBd, BD_DATA_BLOCK, 1, au8File, EEPROM_PAGE_SIZE) != EEP_BD_ERR_INVAL))
+  {
+    u32Failures++;
+    printf("FAIL : an invalid area is accepted\n");
+  }
+
+  vBdLost();
+}
+
+
+/** @brief       This function run the file scenario
+  * @param [IN]  bOneShot : true if the write cycle is signalled by the one-shot timer
+  * @return      none
+ **/
+static void vBdFile(bool bOneShot)
+{
+  vEEPSimReset(0x3300u + (bOneShot ? 1u : 0u), 0u);
+#if defined(EEP_SIM_THREAD)
+  vEEPSimStartThread();
+#endif
+  memset(&sEEP, 0, sizeof(sEEP));
+  memset(&sBd, 0, sizeof(sBd));
+
+  sEEP.eEEPSlaveAddress = EEP24LCXX_ADDR0;
+  sEEP.psI2CInst        = &sEEPSimI2C;
+  sEEP.psTimerInst      = &sEEPSimTimer;
+  sEEP.pfbStartOneShot  = bOneShot ? bEEPSimStartOneShot : NULL_PTR;
+
+  sBd.psEEPObj          = &sEEP;
+  sBd.u16BaseAddress    = 0;
+  sBd.u16BlockSize      = BD_BLOCK_SIZE;
+  sBd.u16BlockCount     = BD_BLOCK_COUNT;
+  sBd.u16CacheSize      = BD_CACHE_SIZE;
+  sBd.u32TimeOutMs      = BD_TIME_OUT_MS;
+
+#if defined(EEP_BD_BLOCKING)
+  printf("blocking, %s\n", bOneShot ? "one-shot" : "poll");
+#else
+  printf("%s\n", bOneShot ? "one-shot" : "poll");
+#endif
+
+  if (bEEP24LCXXBdInit(&sBd) == true)
+  {
+    vBdScenario();
+  }
+  else
+  {
+    u32Failures++;
+    printf("FAIL : init\n");
+  }
+
+#if defined(EEP_SIM_THREAD)
+  vEEPSimStopThread();
+#endif
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+int main(void)
+{
+  uint32_t u32Index;
+
+  for (u32Index = 0; u32Index < BD_FILE_SIZE; u32Index++)
+  {
+    au8File[u32Index] = (uint8_t)((u32Index * 13u) ^ (u32Index >> 8));
+  }
+
+#if defined(EEP_BD_BLOCKING)
+  if (bEEP24LCXXRtosInit() == false)
+  {
+    printf("FAIL : init of the blocking api\n");
+    return 1;
+  }
+#endif
+
+  vBdFile(false);
+  vBdFile(true);
+
+  printf("%s : %u failure(s)\n", (u32Failures == 0u) ? "PASS" : "FAIL", (unsigned)u32Failures);
+
+  return (u32Failures == 0u) ? 0 : 1;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
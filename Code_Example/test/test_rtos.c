@@ -0,0 +1,345 @@
+/********************************************************************************************************************
+* @file		test_rtos.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the test of the blocking api on the host simulator.
+*
+*********************************************************************************************************************
+* @remarks
+*		The POSIX port is used. For the failures the simulator is only stepped by the test : a transfer
+*		started from the interrupt mode stays on the bus until the test steps it, like a HAL which lost its
+*		interrupt. A refused start must never block, even without timeout, and a timed out operation must
+*		leave the bus without starting a transfer over the lost one.
+*		Then the interrupt thread of the simulator runs at the pace of the real time : a 4 KB blocking write
+*		is measured (CPU time and wake-ups of the calling thread), and two threads use two eeproms of the
+*		bus at the same time through the shared bus mutex.
+*
+********************************************************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include "R7FA2E1A9.h"
+#include "eep_24LCXX_rtos.h"
+#include "eep_sim.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define RTOS_TIME_OUT_MS                  (uint32_t)(30)
+#define RTOS_RETURN_MAX_MS                (uint32_t)(500)      /* a call which returns later is considered blocked */
+#define RTOS_STEP_MAX                     (uint32_t)(1000)
+#define RTOS_ADDRESS                      (uint16_t)(0x140)
+#define RTOS_READ_COUNT                   (uint32_t)(4)
+#define RTOS_BULK_TIME_OUT_MS             (uint32_t)(5000)
+#define RTOS_CPU_MAX_PERCENT              (double)(10.0)       /* the calling thread sleeps during the transfers and the write cycles */
+#define RTOS_WAKEUP_PER_PAGE_MAX          (uint32_t)(4)        /* end of the transfer and end of the write cycle, with margin */
+#define RTOS_USER_COUNT                   (uint32_t)(2)
+#define RTOS_USER_SIZE                    (uint16_t)(512)
+#define RTOS_USER_LOOPS                   (uint32_t)(4)
+#define RTOS_MS_PER_SECOND                (double)(1000.0)
+#define RTOS_NS_PER_MS                    (double)(1000000.0)
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+static EEP24LCXXObj_t   sEEP;
+static uint32_t         u32Failures;
+static uint8_t          au8Bulk[EEPROM_DATA_SIZE_MAX];
+static EEP24LCXXObj_t   asUserEEP[RTOS_USER_COUNT];
+static uint8_t          au8UserData[RTOS_USER_COUNT][RTOS_USER_SIZE];
+static uint8_t          au8UserRead[RTOS_USER_COUNT][RTOS_USER_SIZE];
+static bool             abUserOk[RTOS_USER_COUNT];
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function check a result of the test
+  * @param [IN]  bOk    : true if the check passed
+  * @param [IN]  pcWhat : name of the check
+  * @return      none
+ **/
+static void vRtosCheck(bool bOk, const char *pcWhat)
+{
+  if (bOk == false)
+  {
+    u32Failures++;
+    printf("FAIL : %s\n", pcWhat);
+  }
+  else
+  {
+    printf("ok   : %s\n", pcWhat);
+  }
+}
+
+
+/** @brief       This function run a blocking read and measure its duration
+  * @param [IN]  psData       : eeprom data
+  * @param [IN]  u32TimeOutMs : maximum duration of the operation or EEP_OS_WAIT_FOREVER
+  * @param [OUT] pu32Ms       : duration of the call
+  * @return      result of the read
+ **/
+static bool bRtosRead(EEP24LCXXData_t *psData, uint32_t u32TimeOutMs, uint32_t *pu32Ms)
+{
+  uint32_t u32StartMs = u32EEPOsGetTickMs();
+  bool     bRet       = bEEP24LCXXReadBlocking(&sEEP, psData, u32TimeOutMs);
+
+  *pu32Ms = u32EEPOsGetTickMs() - u32StartMs;
+
+  return bRet;
+}
+
+/** @brief       This function read a clock in milliseconds
+  * @param [IN]  eClock : clock
+  * @return      time in milliseconds
+ **/
+static double dRtosClockMs(clockid_t eClock)
+{
+  struct timespec sNow;
+
+  (void)clock_gettime(eClock, &sNow);
+
+  return ((double)sNow.tv_sec * RTOS_MS_PER_SECOND) + ((double)sNow.tv_nsec / RTOS_NS_PER_MS);
+}
+
+
+/** @brief       This function count the times the calling thread has been put to sleep and woken up
+  * @return      number of voluntary context switches of the thread
+ **/
+static uint32_t u32RtosWakeUps(void)
+{
+  struct rusage sUsage;
+
+  (void)getrusage(RUSAGE_THREAD, &sUsage);
+
+  return (uint32_t)sUsage.ru_nvcsw;
+}
+
+
+/** @brief       This function write the whole eeprom with the blocking api and measure the calling thread
+  * @return      none
+ **/
+static void vRtosBulk(void)
+{
+  EEP24LCXXData_t  sData;
+  double           dStartMs;
+  double           dCpuMs;
+  double           dMs;
+  uint32_t         u32WakeUps;
+  uint32_t         u32Index;
+  bool             bRet;
+
+  for (u32Index = 0; u32Index < sizeof(au8Bulk); u32Index++)
+  {
+    au8Bulk[u32Index] = (uint8_t)((u32Index * 7u) ^ (u32Index >> 5));
+  }
+
+  memset(&sData, 0, sizeof(sData));
+  sData.u16StartAddress = 0;
+  sData.pu8Data         = au8Bulk;
+  sData.u16DataSize     = sizeof(au8Bulk);
+
+  dStartMs   = dRtosClockMs(CLOCK_MONOTONIC);
+  dCpuMs     = dRtosClockMs(CLOCK_THREAD_CPUTIME_ID);
+  u32WakeUps = u32RtosWakeUps();
+
+  bRet = bEEP24LCXXWriteBlocking(&sEEP, &sData, RTOS_BULK_TIME_OUT_MS);
+
+  dMs        = dRtosClockMs(CLOCK_MONOTONIC) - dStartMs;
+  dCpuMs     = dRtosClockMs(CLOCK_THREAD_CPUTIME_ID) - dCpuMs;
+  u32WakeUps = u32RtosWakeUps() - u32WakeUps;
+
+  printf("       4096 bytes written in %.1f ms, CPU %.2f ms (%.2f %%), %u wake-ups (%.2f per page)\n",
+         dMs, dCpuMs, (dMs > 0.0) ? ((dCpuMs * 100.0) / dMs) : 0.0, (unsigned)u32WakeUps, (double)u32WakeUps / (sizeof(au8Bulk) / EEPROM_PAGE_SIZE));
+
+  vRtosCheck((bRet == true) && (memcmp(&au8EEPSimMem[0][0], au8Bulk, sizeof(au8Bulk)) == 0), "4 KB blocking write");
+  vRtosCheck((dCpuMs * 100.0) < (RTOS_CPU_MAX_PERCENT * dMs), "the writing thread sleeps during the write");
+  vRtosCheck(u32WakeUps <= (RTOS_WAKEUP_PER_PAGE_MAX * (sizeof(au8Bulk) / EEPROM_PAGE_SIZE)), "wake-ups of the writing thread");
+
+  memset(au8Bulk, 0, sizeof(au8Bulk));
+  bRet = bEEP24LCXXReadBlocking(&sEEP, &sData, RTOS_BULK_TIME_OUT_MS);
+  vRtosCheck((bRet == true) && (memcmp(&au8EEPSimMem[0][0], au8Bulk, sizeof(au8Bulk)) == 0), "4 KB blocking read");
+}
+
+
+/** @brief       This function is a user thread : it writes and reads back its own eeprom of the bus
+  * @param [IN]  pvArg : index of the user
+  * @return      NULL_PTR
+ **/
+static void *pvRtosUser(void *pvArg)
+{
+  uint32_t         u32User = (uint32_t)(uintptr_t)pvArg;
+  EEP24LCXXData_t  sData;
+  uint32_t         u32Loop;
+  uint32_t         u32Index;
+  bool             bOk     = true;
+
+  memset(&sData, 0, sizeof(sData));
+  sData.u16StartAddress = 0;
+  sData.u16DataSize     = RTOS_USER_SIZE;
+
+  for (u32Loop = 0; (u32Loop < RTOS_USER_LOOPS) && (bOk == true); u32Loop++)
+  {
+    for (u32Index = 0; u32Index < RTOS_USER_SIZE; u32Index++)
+    {
+      au8UserData[u32User][u32Index] = (uint8_t)((u32Index + u32Loop) ^ (u32User * 0x5Au));
+    }
+
+    sData.pu8Data = au8UserData[u32User];
+    bOk           = bEEP24LCXXWriteBlocking(&asUserEEP[u32User], &sData, RTOS_BULK_TIME_OUT_MS);
+
+    memset(au8UserRead[u32User], 0, RTOS_USER_SIZE);
+    sData.pu8Data = au8UserRead[u32User];
+    bOk           = bOk && bEEP24LCXXReadBlocking(&asUserEEP[u32User], &sData, RTOS_BULK_TIME_OUT_MS);
+    bOk           = bOk && (memcmp(au8UserRead[u32User], au8UserData[u32User], RTOS_USER_SIZE) == 0);
+  }
+
+  abUserOk[u32User] = bOk;
+
+  return NULL_PTR;
+}
+
+
+/** @brief       This function run the user threads at the same time, each one on its eeprom of the bus
+  * @return      none
+ **/
+static void vRtosUsers(void)
+{
+  pthread_t  asThread[RTOS_USER_COUNT];
+  uint32_t   u32User;
+  bool       bOk = true;
+
+  for (u32User = 0; u32User < RTOS_USER_COUNT; u32User++)
+  {
+    memset(&asUserEEP[u32User], 0, sizeof(asUserEEP[u32User]));
+    asUserEEP[u32User].eEEPSlaveAddress = (u32User == 0u) ? EEP24LCXX_ADDR0 : EEP24LCXX_ADDR1;
+    asUserEEP[u32User].psI2CInst        = &sEEPSimI2C;
+    asUserEEP[u32User].psTimerInst      = &sEEPSimTimer;
+    abUserOk[u32User]                   = false;
+  }
+
+  for (u32User = 0; u32User < RTOS_USER_COUNT; u32User++)
+  {
+    bOk = bOk && (pthread_create(&asThread[u32User], NULL_PTR, pvRtosUser, (void *)(uintptr_t)u32User) == 0);
+  }
+
+  for (u32User = 0; (u32User < RTOS_USER_COUNT) && (bOk == true); u32User++)
+  {
+    (void)pthread_join(asThread[u32User], NULL_PTR);
+    bOk = abUserOk[u32User];
+  }
+
+  vRtosCheck((bOk == true) && (memcmp(&au8EEPSimMem[0][0], au8UserData[0], RTOS_USER_SIZE) == 0) &&
+             (memcmp(&au8EEPSimMem[1][0], au8UserData[1], RTOS_USER_SIZE) == 0) && (sEEPSimStats.u32Collision == 0u),
+             "two threads on two eeproms of the bus");
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+int main(void)
+{
+  uint8_t          au8Buffer[16];
+  EEP24LCXXData_t  sData;
+  uint32_t         u32Ms;
+  uint32_t         u32Step;
+  uint32_t         u32Random;
+  uint32_t         u32Current;
+  bool             bRet;
+
+  vEEPSimReset(0x2610u, 0u);
+  vEEPSimSetImmediate(false);
+  memset(&sEEP, 0, sizeof(sEEP));
+  memset(&sData, 0, sizeof(sData));
+
+  sEEP.eEEPSlaveAddress = EEP24LCXX_ADDR0;
+  sEEP.psI2CInst        = &sEEPSimI2C;
+  sEEP.psTimerInst      = &sEEPSimTimer;
+
+  sData.u16StartAddress = RTOS_ADDRESS;
+  sData.pu8Data         = au8Buffer;
+  sData.u16DataSize     = sizeof(au8Buffer);
+  memset(&au8EEPSimMem[0][RTOS_ADDRESS], 0x5A, sizeof(au8Buffer));
+
+  vRtosCheck((bEEP24LCXXRtosInit() == true) && (bEEP24LCXXInitInst(&sEEP) == true), "init");
+
+  /* a start refused by the bus ends the operation, even without timeout */
+  vEEPSimHoldBus(true);
+  bRet = bRtosRead(&sData, EEP_OS_WAIT_FOREVER, &u32Ms);
+  vRtosCheck((bRet == false) && (u32Ms < RTOS_RETURN_MAX_MS), "refused read without timeout returns");
+  bRet = bEEP24LCXXWriteBlocking(&sEEP, &sData, EEP_OS_WAIT_FOREVER);
+  vRtosCheck(bRet == false, "refused write without timeout returns");
+  vEEPSimHoldBus(false);
+
+  /* the transfer is lost : the read times out and the transfer is left on the bus */
+  bRet = bRtosRead(&sData, RTOS_TIME_OUT_MS, &u32Ms);
+  vRtosCheck((bRet == false) && (u32Ms >= RTOS_TIME_OUT_MS) && (u32Ms < RTOS_RETURN_MAX_MS), "lost transfer times out");
+  vRtosCheck((sEEP.pfeEEPGetTransferState() == EEPROM_STATE_READ_ABORTED) && (bEEP24LCXXAbort() == false), "timed out read is aborted");
+
+  /* no transfer is started over the one still on the bus */
+  bRet = bRtosRead(&sData, EEP_OS_WAIT_FOREVER, &u32Ms);
+  vRtosCheck((bRet == false) && (u32Ms < RTOS_RETURN_MAX_MS) && (sEEPSimStats.u32Collision == 0u), "no start over a pending transfer");
+
+  /* the late end of the transfer does not resume the aborted read */
+  memset(au8Buffer, 0, sizeof(au8Buffer));
+
+  for (u32Step = 0; (u32Step < RTOS_STEP_MAX) && (bEEPSimBusBusy() == true); u32Step++)
+  {
+    vEEPSimStep();
+  }
+
+  vRtosCheck((bEEP24LCXXAbort() == true) && (sEEP.pfeEEPGetTransferState() == EEPROM_STATE_READ_ABORTED), "late end of the transfer is ignored");
+
+  /* the driver is usable again */
+  vEEPSimSetImmediate(true);
+  memset(au8Buffer, 0, sizeof(au8Buffer));
+  bRet = bRtosRead(&sData, EEP_OS_WAIT_FOREVER, &u32Ms);
+  vRtosCheck((bRet == true) && (memcmp(au8Buffer, &au8EEPSimMem[0][RTOS_ADDRESS], sizeof(au8Buffer)) == 0), "read after the end of the lost transfer");
+
+  /* each blocking read binds the object again, consecutive reads still continue from the address pointer */
+  u32Random  = sEEPSimStats.u32RandomRead;
+  u32Current = sEEPSimStats.u32CurrentRead;
+
+  for (u32Step = 0; (u32Step < RTOS_READ_COUNT) && (bRet == true); u32Step++)
+  {
+    sData.u16StartAddress += sData.u16DataSize;
+    bRet = bRtosRead(&sData, EEP_OS_WAIT_FOREVER, &u32Ms);
+  }
+
+  vRtosCheck((bRet == true) && (sEEPSimStats.u32RandomRead == u32Random) && (sEEPSimStats.u32CurrentRead == (u32Current + RTOS_READ_COUNT)),
+             "consecutive reads without address phase");
+
+  /* the transfers end from the interrupt thread */
+  vEEPSimSetImmediate(false);
+  vEEPSimStartThread();
+  vRtosBulk();
+  vRtosUsers();
+  vEEPSimStopThread();
+
+  printf("%s : %u failure(s)\n", (u32Failures == 0u) ? "PASS" : "FAIL", (unsigned)u32Failures);
+
+  return (u32Failures == 0u) ? 0 : 1;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
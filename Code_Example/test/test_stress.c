@@ -0,0 +1,716 @@
+/********************************************************************************************************************
+* @file		test_stress.c
+* @author	Astri Voufo
+* @date		19.10.2026
+*********************************************************************************************************************
+*
+*		This file containt the stress test of the eeprom driver on the host simulator.
+*
+*********************************************************************************************************************
+* @remarks
+*		Random writes, fills, reads, scattered reads, copies and compares run against a shadow of both eeproms,
+*		for each fault rate, with the write cycle polled or signalled by the one-shot timer, with transfers
+*		ending from the interrupt or inside the start call, and with a tick which wraps during the run.
+*		An aborted operation may have written a part of its area : the shadow of this area is taken back
+*		from the simulated memory. Any other difference, or an operation which never ends, is a failure.
+*		The throughput of the operations which succeeded is printed in bytes per simulated second. The end of
+*		each operation must be reported once, and a mirror of the whole eeprom must take one write cycle per page.
+*
+********************************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "R7FA2E1A9.h"
+#include "eep_24LCXX.h"
+#include "eep_sim.h"
+
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               D E F I N I T I O N                                                *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+#define STRESS_OPS                        (uint32_t)(1200)
+#define STRESS_STEP_MAX                   (uint32_t)(200000)
+#define STRESS_CHECK_PERIOD               (uint32_t)(64)
+#define STRESS_LENGTH_MAX                 (uint16_t)(200)
+#define STRESS_CHIP_A                     (uint8_t)(0)
+#define STRESS_CHIP_B                     (uint8_t)(5)
+#define STRESS_SCATTER_RECORDS            (uint8_t)(6)
+#define STRESS_DEPTH_MAX                  (uint32_t)(3)
+#define STRESS_PAGES                      (uint32_t)(EEP_SIM_MEM_SIZE / EEPROM_PAGE_SIZE)
+#define STRESS_MIRROR_MIN_US              (uint64_t)(STRESS_PAGES * 5000u)   /* tWC waited by the driver for each page */
+#define STRESS_MIRROR_MAX_US              (uint64_t)(STRESS_PAGES * 7000u)   /* tWC, one tick and the page write */
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              E N U M E R A T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+typedef enum
+{
+  STRESS_OK      = 0,
+  STRESS_ABORTED = 1,
+  STRESS_HANG    = 2
+} eStressResult_t;
+
+typedef enum
+{
+  STRESS_OP_WRITE   = 0,
+  STRESS_OP_FILL    = 1,
+  STRESS_OP_READ    = 2,
+  STRESS_OP_SCATTER = 3,
+  STRESS_OP_COPY    = 4,
+  STRESS_OP_COMPARE = 5,
+
+  STRESS_OP_MAX
+} eStressOp_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                              S T R U C T U R E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/*
+ * result of a configuration
+ */
+typedef struct
+{
+  uint32_t  u32Ok;
+  uint32_t  u32Aborted;
+  uint32_t  u32Hang;
+  uint32_t  u32Mismatch;
+  uint64_t  u64WriteBytes;
+  uint64_t  u64WriteUs;
+  uint64_t  u64ReadBytes;
+  uint64_t  u64ReadUs;
+} StressResult_t;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                               V A R I A B L E                                                    *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+static uint8_t          au8Shadow[EEP_SIM_CHIP_COUNT][EEP_SIM_MEM_SIZE];
+static EEP24LCXXObj_t   asEEP[2];
+static StressResult_t   sResult;
+static uint32_t         u32Failures;
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P R I V A T E   F U N C T I O N                                               *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+/** @brief       This function draw a number in a range
+  * @param [IN]  u32Min : first value
+  * @param [IN]  u32Max : last value
+  * @return      random number
+ **/
+static uint32_t u32StressRange(uint32_t u32Min, uint32_t u32Max)
+{
+  return u32Min + (u32EEPSimRandom() % (u32Max - u32Min + 1u));
+}
+
+
+/** @brief       This function run an operation of the driver until it ends
+  * @param [IN]  pfbPoll  : poll function of the operation
+  * @param [IN]  pvArg    : description of the operation
+  * @param [IN]  eAborted : state of an aborted operation
+  * @return      result of the operation
+ **/
+static eStressResult_t eStressRun(bool (*pfbPoll)(void *pvArg), void *pvArg, EEPROM24XXTransferState_t eAborted)
+{
+  eStressResult_t eRet     = STRESS_HANG;
+  bool            bStarted = false;
+  uint32_t        u32Step;
+
+  for (u32Step = 0; (u32Step < STRESS_STEP_MAX) && (eRet == STRESS_HANG); u32Step++)
+  {
+    if ((bStarted == true) && (asEEP[0].pfeEEPGetTransferState() == eAborted))
+    {
+      eRet = STRESS_ABORTED;
+    }
+    else if (pfbPoll(pvArg) == true)
+    {
+      eRet = STRESS_OK;
+    }
+    else
+    {
+      bStarted = true;
+      __WFI();
+    }
+  }
+
+  return eRet;
+}
+
+
+static bool bStressWrite(void *pvArg)   { return asEEP[0].pfbEEPWriteData((EEP24LCXXData_t *)pvArg); }
+static bool bStressFill(void *pvArg)    { return asEEP[0].pfbEEPFillData((EEP24LCXXFill_t *)pvArg); }
+static bool bStressCopy(void *pvArg)    { return bEEP24LCXXCopyData((EEP24LCXXCopy_t *)pvArg); }
+static bool bStressCompare(void *pvArg) { return bEEP24LCXXCompareData((EEP24LCXXCopy_t *)pvArg); }
+static bool bStressRead(void *pvArg)    { return asEEP[0].pfbEEPReadData((EEP24LCXXData_t *)pvArg); }
+static bool bStressScatter(void *pvArg) { return asEEP[0].pfbEEPReadScattered((EEP24LCXXScatter_t *)pvArg); }
+
+
+/** @brief       This function check that the end of an operation is reported once : an operation which ended
+  *              from the interrupt is reported by the next call without new transfer, the call after it starts
+  *              the operation again
+  * @param [IN]  pfbPoll  : poll function of the operation
+  * @param [IN]  pvArg    : description of the operation
+  * @param [IN]  eEnd     : state at the end of the operation
+  * @param [IN]  eAborted : state of an aborted operation
+  * @param [IN]  pcWhat   : name of the operation
+  * @return      none
+ **/
+static void vStressReportOnce(bool (*pfbPoll)(void *pvArg), void *pvArg, EEPROM24XXTransferState_t eEnd, EEPROM24XXTransferState_t eAborted, const char *pcWhat)
+{
+  uint32_t u32Transfers;
+  uint32_t u32Step;
+  bool     bEnded = pfbPoll(pvArg);
+
+  /* the poll is not called anymore once the interrupt has ended the operation */
+  for (u32Step = 0; (bEnded == false) && (u32Step < STRESS_STEP_MAX) && (asEEP[0].pfeEEPGetTransferState() != eEnd); u32Step++)
+  {
+    __WFI();
+
+    if (asEEP[0].pfeEEPGetTransferState() != eEnd)
+    {
+      bEnded = pfbPoll(pvArg);
+    }
+  }
+
+  u32Transfers = sEEPSimStats.u32Transfers;
+
+  if ((bEnded == false) && ((pfbPoll(pvArg) == false) || (sEEPSimStats.u32Transfers != u32Transfers)))
+  {
+    u32Failures++;
+    printf("FAIL : the end of the %s is not reported by the next call\n", pcWhat);
+  }
+  else
+  {
+    /* the next call starts a new operation, which may end in its start call or wait for a write cycle */
+    bEnded = pfbPoll(pvArg);
+
+    if ((bEnded == true) ? (sEEPSimStats.u32Transfers == u32Transfers) : (asEEP[0].pfeEEPGetTransferState() == eEnd))
+    {
+      u32Failures++;
+      printf("FAIL : a reported %s is not started again\n", pcWhat);
+    }
+    else if ((bEnded == false) && (eStressRun(pfbPoll, pvArg, eAborted) != STRESS_OK))
+    {
+      u32Failures++;
+      printf("FAIL : the %s started again does not end\n", pcWhat);
+    }
+    else
+    {
+      /* reported once */
+    }
+  }
+}
+
+
+/** @brief       This function check an area of the simulated memory against the shadow
+  * @param [IN]  u8Chip    : chip select of the eeprom
+  * @param [IN]  u16Start  : first address
+  * @param [IN]  u16Length : number of bytes
+  * @param [IN]  pcWhat    : name of the check
+  * @return      none
+ **/
+static void vStressCheckMem(uint8_t u8Chip, uint16_t u16Start, uint16_t u16Length, const char *pcWhat)
+{
+  if (memcmp(&au8EEPSimMem[u8Chip][u16Start], &au8Shadow[u8Chip][u16Start], u16Length) != 0)
+  {
+    sResult.u32Mismatch++;
+    printf("  MISMATCH %s : chip %u, 0x%03X + %u\n", pcWhat, u8Chip, u16Start, u16Length);
+  }
+}
+
+
+/** @brief       This function take the shadow of an area back from the simulated memory, after an abort
+  * @param [IN]  u8Chip    : chip select of the eeprom
+  * @param [IN]  u16Start  : first address
+  * @param [IN]  u16Length : number of bytes
+  * @return      none
+ **/
+static void vStressResync(uint8_t u8Chip, uint16_t u16Start, uint16_t u16Length)
+{
+  memcpy(&au8Shadow[u8Chip][u16Start], &au8EEPSimMem[u8Chip][u16Start], u16Length);
+}
+
+
+/** @brief       This function count the result of an operation and its throughput
+  * @param [IN]  eRes      : result of the operation
+  * @param [IN]  bWrite    : true for an operation which writes
+  * @param [IN]  u16Bytes  : bytes of the operation
+  * @param [IN]  u64Start  : time of the start
+  * @return      none
+ **/
+static void vStressCount(eStressResult_t eRes, bool bWrite, uint16_t u16Bytes, uint64_t u64Start)
+{
+  uint64_t u64Time = u64EEPSimTimeUs() - u64Start;
+
+  if (eRes == STRESS_OK)
+  {
+    sResult.u32Ok++;
+
+    if (bWrite == true)
+    {
+      sResult.u64WriteBytes += u16Bytes;
+      sResult.u64WriteUs    += u64Time;
+    }
+    else
+    {
+      sResult.u64ReadBytes += u16Bytes;
+      sResult.u64ReadUs    += u64Time;
+    }
+  }
+  else if (eRes == STRESS_ABORTED)
+  {
+    sResult.u32Aborted++;
+  }
+  else
+  {
+    sResult.u32Hang++;
+    printf("  HANG : state %d\n", (int)asEEP[0].pfeEEPGetTransferState());
+  }
+}
+
+
+/** @brief       This function run one random operation and check it against the shadow
+  * @return      none
+ **/
+static void vStressOperation(void)
+{
+  static uint8_t      au8Data[EEP_SIM_MEM_SIZE];
+  static uint8_t      au8Buffer[EEP_SIM_MEM_SIZE];
+  EEP24LCXXData_t     sData;
+  EEP24LCXXFill_t     sFill;
+  EEP24LCXXCopy_t     sCopy;
+  EEP24LCXXScatter_t  sScatter;
+  EEP24LCXXRecord_t   asRecords[STRESS_SCATTER_RECORDS];
+  eStressResult_t     eRes;
+  uint64_t            u64Start = u64EEPSimTimeUs();
+  uint16_t            u16Address;
+  uint16_t            u16Length;
+  uint16_t            u16Index;
+  uint16_t            u16Offset;
+  uint8_t             u8Src;
+  uint8_t             u8Dst;
+  uint8_t             u8Count;
+
+  memset(&sData, 0, sizeof(sData));
+  memset(&sFill, 0, sizeof(sFill));
+  memset(&sCopy, 0, sizeof(sCopy));
+  memset(&sScatter, 0, sizeof(sScatter));
+
+  u16Length  = (uint16_t)u32StressRange(1u, STRESS_LENGTH_MAX);
+  u16Address = (uint16_t)u32StressRange(0u, EEP_SIM_MEM_SIZE - u16Length);
+
+  switch ((eStressOp_t)(u32EEPSimRandom() % STRESS_OP_MAX))
+  {
+    case STRESS_OP_WRITE:
+      for (u16Index = 0; u16Index < u16Length; u16Index++)
+      {
+        au8Data[u16Index] = (uint8_t)u32EEPSimRandom();
+      }
+
+      sData.u16StartAddress = u16Address;
+      sData.pu8Data         = au8Data;
+      sData.u16DataSize     = u16Length;
+      eRes                  = eStressRun(bStressWrite, &sData, EEPROM_STATE_WRITE_ABORTED);
+
+      if (eRes == STRESS_OK)
+      {
+        memcpy(&au8Shadow[STRESS_CHIP_A][u16Address], au8Data, u16Length);
+        vStressCheckMem(STRESS_CHIP_A, u16Address, u16Length, "write");
+      }
+      else
+      {
+        vStressResync(STRESS_CHIP_A, u16Address, u16Length);
+      }
+
+      vStressCount(eRes, true, u16Length, u64Start);
+      break;
+
+    case STRESS_OP_FILL:
+      sFill.u16StartAddress = u16Address;
+      sFill.u16DataSize     = u16Length;
+      sFill.u8Pattern       = ((u32EEPSimRandom() & 1u) == 0u) ? EEPROM_ERASE : (uint8_t)u32EEPSimRandom();
+      sFill.bSkipBlank      = ((u32EEPSimRandom() & 1u) == 0u);
+      eRes                  = eStressRun(bStressFill, &sFill, EEPROM_STATE_WRITE_ABORTED);
+
+      if (eRes == STRESS_OK)
+      {
+        memset(&au8Shadow[STRESS_CHIP_A][u16Address], sFill.u8Pattern, u16Length);
+        vStressCheckMem(STRESS_CHIP_A, u16Address, u16Length, "fill");
+      }
+      else
+      {
+        vStressResync(STRESS_CHIP_A, u16Address, u16Length);
+      }
+
+      vStressCount(eRes, true, u16Length, u64Start);
+      break;
+
+    case STRESS_OP_READ:
+      sData.u16StartAddress = u16Address;
+      sData.pu8Data         = au8Buffer;
+      sData.u16DataSize     = u16Length;
+      eRes                  = eStressRun(bStressRead, &sData, EEPROM_STATE_READ_ABORTED);
+
+      if ((eRes == STRESS_OK) && (memcmp(au8Buffer, &au8Shadow[STRESS_CHIP_A][u16Address], u16Length) != 0))
+      {
+        sResult.u32Mismatch++;
+        printf("  MISMATCH read : 0x%03X + %u\n", u16Address, u16Length);
+      }
+
+      vStressCount(eRes, false, u16Length, u64Start);
+      break;
+
+    case STRESS_OP_SCATTER:
+      u8Count    = (uint8_t)u32StressRange(1u, STRESS_SCATTER_RECORDS);
+      u16Address = (uint16_t)u32StressRange(0u, 64u);
+      u16Length  = 0;
+
+      for (u16Index = 0; u16Index < u8Count; u16Index++)
+      {
+        asRecords[u16Index].u16Address  = u16Address;
+        asRecords[u16Index].u16DataSize = (uint16_t)u32StressRange(1u, 24u);
+        asRecords[u16Index].pu8Data     = &au8Buffer[u16Length];
+        u16Length  += asRecords[u16Index].u16DataSize;
+        u16Address += asRecords[u16Index].u16DataSize + (uint16_t)u32StressRange(0u, 40u);
+      }
+
+      sScatter.psRecords     = asRecords;
+      sScatter.u8RecordCount = u8Count;
+      eRes                   = eStressRun(bStressScatter, &sScatter, EEPROM_STATE_READ_ABORTED);
+
+      for (u16Index = 0; (eRes == STRESS_OK) && (u16Index < u8Count); u16Index++)
+      {
+        if (memcmp(asRecords[u16Index].pu8Data, &au8Shadow[STRESS_CHIP_A][asRecords[u16Index].u16Address], asRecords[u16Index].u16DataSize) != 0)
+        {
+          sResult.u32Mismatch++;
+          printf("  MISMATCH scatter : record %u at 0x%03X\n", u16Index, asRecords[u16Index].u16Address);
+        }
+      }
+
+      vStressCount(eRes, false, u16Length, u64Start);
+      break;
+
+    case STRESS_OP_COPY:
+      u8Src               = (uint8_t)(u32EEPSimRandom() & 1u);
+      u8Dst               = (uint8_t)(u32EEPSimRandom() & 1u);
+      sCopy.psSrcEEP      = &asEEP[u8Src];
+      sCopy.psDstEEP      = &asEEP[u8Dst];
+      sCopy.u16SrcAddress = u16Address;
+      sCopy.u16DstAddress = (uint16_t)u32StressRange(0u, EEP_SIM_MEM_SIZE - u16Length);
+      sCopy.u16DataSize   = u16Length;
+      u8Src               = (u8Src == 0u) ? STRESS_CHIP_A : STRESS_CHIP_B;
+      u8Dst               = (u8Dst == 0u) ? STRESS_CHIP_A : STRESS_CHIP_B;
+
+      if ((u8Src == u8Dst) && (sCopy.u16DstAddress < (sCopy.u16SrcAddress + u16Length)) && (sCopy.u16SrcAddress < (sCopy.u16DstAddress + u16Length)))
+      {
+        /* the areas of a copy in the same eeprom must not overlap */
+        sCopy.u16DstAddress = (uint16_t)((sCopy.u16SrcAddress + u16Length + u32StressRange(0u, 64u)) % (EEP_SIM_MEM_SIZE - u16Length));
+
+        if ((sCopy.u16DstAddress < (sCopy.u16SrcAddress + u16Length)) && (sCopy.u16SrcAddress < (sCopy.u16DstAddress + u16Length)))
+        {
+          break;
+        }
+      }
+
+      eRes = eStressRun(bStressCopy, &sCopy, EEPROM_STATE_WRITE_ABORTED);
+
+      if (eRes == STRESS_OK)
+      {
+        memmove(&au8Shadow[u8Dst][sCopy.u16DstAddress], &au8Shadow[u8Src][sCopy.u16SrcAddress], u16Length);
+        vStressCheckMem(u8Dst, sCopy.u16DstAddress, u16Length, "copy");
+      }
+      else
+      {
+        vStressResync(u8Dst, sCopy.u16DstAddress, u16Length);
+      }
+
+      vStressCount(eRes, true, u16Length, u64Start);
+      break;
+
+    default:
+      sCopy.psSrcEEP      = &asEEP[0];
+      sCopy.psDstEEP      = &asEEP[1];
+      sCopy.u16SrcAddress = u16Address;
+      sCopy.u16DstAddress = u16Address;
+      sCopy.u16DataSize   = u16Length;
+      eRes                = eStressRun(bStressCompare, &sCopy, EEPROM_STATE_READ_ABORTED);
+
+      if (eRes == STRESS_OK)
+      {
+        for (u16Offset = 0; (u16Offset < u16Length) && (au8Shadow[STRESS_CHIP_A][u16Address + u16Offset] == au8Shadow[STRESS_CHIP_B][u16Address + u16Offset]); u16Offset++)
+        {
+        }
+
+        if ((sCopy.bEqual != (u16Offset == u16Length)) || ((sCopy.bEqual == false) && (sCopy.u16MismatchOffset != u16Offset)))
+        {
+          sResult.u32Mismatch++;
+          printf("  MISMATCH compare : 0x%03X + %u, equal %d offset %u, expected offset %u\n", u16Address, u16Length, sCopy.bEqual, sCopy.u16MismatchOffset, u16Offset);
+        }
+      }
+
+      vStressCount(eRes, false, u16Length, u64Start);
+      break;
+  }
+}
+
+
+/** @brief       This function mirror the whole eeprom A in the eeprom B and compare them : the copy takes one
+  *              write cycle per page, the next source page is read during the write cycle of the destination
+  * @return      none
+ **/
+static void vStressMirror(void)
+{
+  EEP24LCXXCopy_t sCopy;
+  uint64_t        u64Start;
+  uint64_t        u64Time;
+
+  memset(&sCopy, 0, sizeof(sCopy));
+  sCopy.psSrcEEP    = &asEEP[0];
+  sCopy.psDstEEP    = &asEEP[1];
+  sCopy.u16DataSize = EEP_SIM_MEM_SIZE;
+
+  u64Start = u64EEPSimTimeUs();
+
+  if (eStressRun(bStressCopy, &sCopy, EEPROM_STATE_WRITE_ABORTED) != STRESS_OK)
+  {
+    u32Failures++;
+    printf("FAIL : mirror does not end\n");
+    return;
+  }
+
+  u64Time = u64EEPSimTimeUs() - u64Start;
+  memcpy(au8Shadow[STRESS_CHIP_B], au8Shadow[STRESS_CHIP_A], EEP_SIM_MEM_SIZE);
+  vStressCheckMem(STRESS_CHIP_B, 0, EEP_SIM_MEM_SIZE, "mirror");
+
+  if ((u64Time < STRESS_MIRROR_MIN_US) || (u64Time > STRESS_MIRROR_MAX_US))
+  {
+    u32Failures++;
+    printf("FAIL : mirror of %u pages in %.1f ms, expected %.0f to %.0f ms\n", STRESS_PAGES, u64Time / 1e3, STRESS_MIRROR_MIN_US / 1e3, STRESS_MIRROR_MAX_US / 1e3);
+  }
+
+  if ((eStressRun(bStressCompare, &sCopy, EEPROM_STATE_READ_ABORTED) != STRESS_OK) || (sCopy.bEqual == false))
+  {
+    u32Failures++;
+    printf("FAIL : mirror not equal\n");
+  }
+
+  printf("        mirror %u B in %.1f ms (%.2f ms per page)\n", EEP_SIM_MEM_SIZE, u64Time / 1e3, u64Time / 1e3 / STRESS_PAGES);
+}
+
+
+/** @brief       This function check the requests which must be refused or aborted at once
+  * @return      none
+ **/
+static void vStressDirected(void)
+{
+  uint8_t          au8Buffer[16];
+  EEP24LCXXData_t  sData;
+  EEP24LCXXCopy_t  sCopy;
+  EEP24LCXXFill_t  sFill;
+  uint32_t         u32Transfers;
+
+  memset(&sData, 0, sizeof(sData));
+  memset(&sCopy, 0, sizeof(sCopy));
+
+  /* a read refused by the bus is aborted and leaves the driver usable */
+  sData.u16StartAddress = 0x100;
+  sData.pu8Data         = au8Buffer;
+  sData.u16DataSize     = sizeof(au8Buffer);
+
+  vEEPSimHoldBus(true);
+
+  if ((asEEP[0].pfbEEPReadData(&sData) == true) || (asEEP[0].pfeEEPGetTransferState() != EEPROM_STATE_READ_ABORTED))
+  {
+    u32Failures++;
+    printf("FAIL : a read refused by the bus is not aborted (state %d)\n", (int)asEEP[0].pfeEEPGetTransferState());
+  }
+
+  vEEPSimHoldBus(false);
+
+  if ((eStressRun(bStressRead, &sData, EEPROM_STATE_READ_ABORTED) != STRESS_OK) || (memcmp(au8Buffer, &au8Shadow[STRESS_CHIP_A][0x100], sizeof(au8Buffer)) != 0))
+  {
+    u32Failures++;
+    printf("FAIL : no read after a read refused by the bus\n");
+  }
+
+  /* the end of a read is reported once, the next call starts a new read which can end in its start */
+  u32Transfers = sEEPSimStats.u32Transfers;
+
+  if ((asEEP[0].pfbEEPReadData(&sData) == false) && (eStressRun(bStressRead, &sData, EEPROM_STATE_READ_ABORTED) != STRESS_OK))
+  {
+    u32Failures++;
+    printf("FAIL : no read after a reported read\n");
+  }
+  else if (sEEPSimStats.u32Transfers == u32Transfers)
+  {
+    u32Failures++;
+    printf("FAIL : a reported read is not started again\n");
+  }
+
+  /* a fill of blank pages ended in the start calls goes on in a loop, not by recursion */
+  memset(&sFill, 0, sizeof(sFill));
+  sFill.u16DataSize     = EEP_SIM_MEM_SIZE;
+  sFill.u8Pattern       = EEPROM_ERASE;
+  sFill.bSkipBlank      = true;
+  sEEPSimStats.u32DepthMax = 0;
+
+  if ((eStressRun(bStressFill, &sFill, EEPROM_STATE_WRITE_ABORTED) != STRESS_OK) || (sEEPSimStats.u32DepthMax > STRESS_DEPTH_MAX))
+  {
+    u32Failures++;
+    printf("FAIL : blank fill, nesting depth %u\n", sEEPSimStats.u32DepthMax);
+  }
+
+  /* the end of a fill, a copy and a compare is reported once, as the end of a read */
+  sFill.u16StartAddress = 0x300;
+  sFill.u16DataSize     = 2u * EEPROM_PAGE_SIZE;
+  sFill.u8Pattern       = 0x5A;
+  sFill.bSkipBlank      = false;
+  vStressReportOnce(bStressFill, &sFill, EEPROM_STATE_WRITE_COMPLETED, EEPROM_STATE_WRITE_ABORTED, "fill");
+  memset(&au8Shadow[STRESS_CHIP_A][0x300], 0x5A, 2u * EEPROM_PAGE_SIZE);
+
+  sCopy.psSrcEEP      = &asEEP[0];
+  sCopy.psDstEEP      = &asEEP[1];
+  sCopy.u16SrcAddress = 0x300;
+  sCopy.u16DstAddress = 0x300;
+  sCopy.u16DataSize   = 2u * EEPROM_PAGE_SIZE;
+  vStressReportOnce(bStressCopy, &sCopy, EEPROM_STATE_WRITE_COMPLETED, EEPROM_STATE_WRITE_ABORTED, "copy");
+  memcpy(&au8Shadow[STRESS_CHIP_B][0x300], &au8Shadow[STRESS_CHIP_A][0x300], 2u * EEPROM_PAGE_SIZE);
+  vStressReportOnce(bStressCompare, &sCopy, EEPROM_STATE_COMPARE_COMPLETED, EEPROM_STATE_READ_ABORTED, "compare");
+
+  /* a copy between overlapping areas of the same eeprom is refused */
+  sCopy.psSrcEEP      = &asEEP[0];
+  sCopy.psDstEEP      = &asEEP[0];
+  sCopy.u16SrcAddress = 0x200;
+  sCopy.u16DstAddress = 0x210;
+  sCopy.u16DataSize   = 64;
+
+  u32Transfers        = sEEPSimStats.u32Transfers;
+
+  if ((bEEP24LCXXCopyData(&sCopy) == true) || (asEEP[0].pfeEEPGetTransferState() != EEPROM_STATE_COMPARE_COMPLETED) || (sEEPSimStats.u32Transfers != u32Transfers))
+  {
+    u32Failures++;
+    printf("FAIL : an overlapping copy is not refused\n");
+  }
+}
+
+
+/** @brief       This function run a configuration of the stress test
+  * @param [IN]  u16FaultPerMille : rate of each fault, in per mille
+  * @param [IN]  bOneShot         : true if the write cycle is signalled by the one-shot timer
+  * @param [IN]  bImmediate       : true if the transfers end inside the start call
+  * @param [IN]  bWrap            : true if the tick wraps during the run
+  * @return      none
+ **/
+static void vStressConfig(uint16_t u16FaultPerMille, bool bOneShot, bool bImmediate, bool bWrap)
+{
+  EEPSimFaults_t sFaults;
+  uint32_t       u32Op;
+  uint8_t        u8Chip;
+
+  vEEPSimReset(0x1234567u + u16FaultPerMille + (bOneShot ? 100u : 0u) + (bImmediate ? 200u : 0u), bWrap ? EEP_SIM_WRAP_OFFSET_MS : 0u);
+  vEEPSimSetImmediate(bImmediate);
+  memcpy(au8Shadow, au8EEPSimMem, sizeof(au8Shadow));
+  memset(&sResult, 0, sizeof(sResult));
+  memset(asEEP, 0, sizeof(asEEP));
+
+  asEEP[0].eEEPSlaveAddress = EEP24LCXX_ADDR0;
+  asEEP[1].eEEPSlaveAddress = EEP24LCXX_ADDR5;
+
+  for (u8Chip = 0; u8Chip < 2u; u8Chip++)
+  {
+    asEEP[u8Chip].psI2CInst       = &sEEPSimI2C;
+    asEEP[u8Chip].psTimerInst     = &sEEPSimTimer;
+    asEEP[u8Chip].pfbStartOneShot = bOneShot ? bEEPSimStartOneShot : NULL_PTR;
+  }
+
+  /* the driver is bound to the first eeprom, the copies and compares also use the second one */
+  if (bEEP24LCXXInitInst(&asEEP[0]) == false)
+  {
+    u32Failures++;
+    printf("FAIL : init\n");
+    return;
+  }
+
+  vStressDirected();
+  vStressMirror();
+
+  sFaults.u16Nack        = u16FaultPerMille;
+  sFaults.u16ArbLost     = u16FaultPerMille;
+  sFaults.u16TimeOut     = u16FaultPerMille / 4u;
+  sFaults.u16StartFail   = u16FaultPerMille;
+  sFaults.u16Stretch     = u16FaultPerMille * 4u;
+  sFaults.u16Stray       = u16FaultPerMille;
+  sFaults.u16OneShotFail = u16FaultPerMille;
+  vEEPSimSetFaults(&sFaults);
+
+  for (u32Op = 0; u32Op < STRESS_OPS; u32Op++)
+  {
+    vStressOperation();
+
+    if ((u32Op % STRESS_CHECK_PERIOD) == 0u)
+    {
+      vStressCheckMem(STRESS_CHIP_A, 0, EEP_SIM_MEM_SIZE, "memory A");
+      vStressCheckMem(STRESS_CHIP_B, 0, EEP_SIM_MEM_SIZE, "memory B");
+    }
+  }
+
+  vStressCheckMem(STRESS_CHIP_A, 0, EEP_SIM_MEM_SIZE, "memory A");
+  vStressCheckMem(STRESS_CHIP_B, 0, EEP_SIM_MEM_SIZE, "memory B");
+
+  printf("%5.1f%%  %-8s %-9s %-4s  ok %4u  aborted %4u  hang %u  mismatch %u  collision %u  write %6.0f B/s  read %7.0f B/s\n",
+         u16FaultPerMille / 10.0, bOneShot ? "one-shot" : "poll", bImmediate ? "immediate" : "interrupt", bWrap ? "wrap" : "",
+         sResult.u32Ok, sResult.u32Aborted, sResult.u32Hang, sResult.u32Mismatch, sEEPSimStats.u32Collision,
+         (sResult.u64WriteUs > 0u) ? (sResult.u64WriteBytes * 1e6 / sResult.u64WriteUs) : 0.0,
+         (sResult.u64ReadUs > 0u) ? (sResult.u64ReadBytes * 1e6 / sResult.u64ReadUs) : 0.0);
+
+  u32Failures += sResult.u32Hang + sResult.u32Mismatch + sEEPSimStats.u32Collision;
+
+  if ((u16FaultPerMille == 0u) && (sResult.u32Aborted > 0u))
+  {
+    u32Failures++;
+    printf("FAIL : operations aborted without fault\n");
+  }
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                    P U B L I C  F U N C T I O N                                                  *
+ *                                                                                                                  *
+ *******************************************************************************************************************/
+
+int main(void)
+{
+  static const uint16_t au16Rates[] = { 0u, 10u, 50u, 200u };
+  uint8_t               u8Rate;
+  uint8_t               u8Mode;
+
+  printf("fault   mode     transfers\n");
+
+  for (u8Rate = 0; u8Rate < (sizeof(au16Rates) / sizeof(au16Rates[0])); u8Rate++)
+  {
+    for (u8Mode = 0; u8Mode < 4u; u8Mode++)
+    {
+      vStressConfig(au16Rates[u8Rate], (u8Mode & 1u) != 0u, (u8Mode & 2u) != 0u, (u8Rate & 1u) != 0u);
+    }
+  }
+
+  printf("%s : %u failure(s)\n", (u32Failures == 0u) ? "PASS" : "FAIL", u32Failures);
+
+  return (u32Failures == 0u) ? 0 : 1;
+}
+
+/********************************************************************************************************************
+ *                                                                                                                  *
+ *                                        E N D   OF  M O D U L E                                                   *
+ *                                                                                                                  *
+ *******************************************************************************************************************/